@@ -8,6 +8,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <numeric>
+#include <vector>
 #include <benchmark/benchmark.h>
 #include <trial/online/circular_span.hpp>
 
@@ -95,4 +97,94 @@ void push_front_pop_back(benchmark::State& state)
 
 BENCHMARK(push_front_pop_back);
 
+// Power-of-two capacities use a mask for indexing, whereas other capacities
+// use modulo.
+
+void capacity_push_back(benchmark::State& state)
+{
+    std::vector<int> storage(state.range(0));
+    trial::online::circular_span<int> window(storage.begin(), storage.end());
+
+    for (auto _ : state)
+    {
+        window.push_back(42);
+        benchmark::DoNotOptimize(window.front());
+    }
+}
+
+BENCHMARK(capacity_push_back)->Arg(255)->Arg(256);
+
+void capacity_accumulate(benchmark::State& state)
+{
+    std::vector<int> storage(state.range(0));
+    trial::online::circular_span<int> window(storage.begin(), storage.end());
+    for (std::size_t k = 0; k < 2 * storage.size(); ++k)
+    {
+        window.push_back(int(k));
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(window.begin(), window.end(), 0));
+    }
+}
+
+BENCHMARK(capacity_accumulate)->Arg(255)->Arg(256);
+
+void push_back_range(benchmark::State& state)
+{
+    int storage[256];
+    trial::online::circular_span<int> window(storage);
+    std::vector<int> input(state.range(0), 42);
+
+    for (auto _ : state)
+    {
+        window.push_back(input.begin(), input.end());
+        benchmark::DoNotOptimize(storage);
+    }
+    state.SetItemsProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(push_back_range)->Arg(64)->Arg(1024);
+
+void push_back_loop(benchmark::State& state)
+{
+    int storage[256];
+    trial::online::circular_span<int> window(storage);
+    std::vector<int> input(state.range(0), 42);
+
+    for (auto _ : state)
+    {
+        for (auto value : input)
+        {
+            window.push_back(value);
+        }
+        benchmark::DoNotOptimize(storage);
+    }
+    state.SetItemsProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(push_back_loop)->Arg(64)->Arg(1024);
+
+void segment_accumulate(benchmark::State& state)
+{
+    std::vector<int> storage(state.range(0));
+    trial::online::circular_span<int> window(storage.begin(), storage.end());
+    for (std::size_t k = 0; k < storage.size() + storage.size() / 2; ++k)
+    {
+        window.push_back(int(k));
+    }
+
+    for (auto _ : state)
+    {
+        const auto one = window.array_one();
+        const auto two = window.array_two();
+        auto result = std::accumulate(one.first, one.first + one.second, 0);
+        result = std::accumulate(two.first, two.first + two.second, result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(segment_accumulate)->Arg(255)->Arg(256);
+
 BENCHMARK_MAIN();
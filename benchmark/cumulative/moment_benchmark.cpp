@@ -86,4 +86,26 @@ void cumulative_kurtosis(benchmark::State& state)
 
 BENCHMARK(cumulative_kurtosis);
 
+template <typename Filter>
+void cumulative_range(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    const auto blocksize = std::size_t(state.range(0));
+    Filter filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        const auto first = values.begin() + (k % (values.size() / blocksize)) * blocksize;
+        filter.push(first, first + blocksize);
+        benchmark::DoNotOptimize(filter.mean());
+        ++k;
+    }
+    state.SetItemsProcessed(state.iterations() * blocksize);
+}
+
+BENCHMARK_TEMPLATE(cumulative_range, trial::online::cumulative::moment<double>)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(cumulative_range, trial::online::cumulative::moment_variance<double>)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(cumulative_range, trial::online::cumulative::moment_skewness<double>)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(cumulative_range, trial::online::cumulative::moment_kurtosis<double>)->Arg(64)->Arg(4096);
+
 BENCHMARK_MAIN();
@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <benchmark/benchmark.h>
 #include <trial/online/window/moment.hpp>
+#include <trial/online/window/lazy_moment.hpp>
+#include <trial/online/window/multi_moment.hpp>
 
 const std::size_t datasize = 1<<15;
 
@@ -54,16 +56,148 @@ void window_variance(benchmark::State& state)
     }
 }
 
+template <std::size_t Window>
+void window_variance_int(benchmark::State& state)
+{
+    std::vector<int> values(datasize);
+    std::random_device device;
+    std::default_random_engine generator(device());
+    std::uniform_int_distribution<int> distribution(0, 1000000);
+    std::generate(values.begin(), values.end(), [&] { return distribution(generator); });
+    trial::online::window::moment_variance<int, Window> filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.variance());
+        ++k;
+    }
+}
+
+template <typename Storage>
+void window_variance_storage(benchmark::State& state)
+{
+    using namespace trial::online;
+    auto values = dataset<double>(datasize);
+    window::basic_moment<double, dynamic_extent, with::variance, Storage> filter(state.range(0));
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.variance());
+        ++k;
+    }
+}
+
+// Query once per window length
+template <std::size_t Window>
+void window_lazy_variance(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    trial::online::window::lazy_moment_variance<double, Window> filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        if (k % Window == 0)
+        {
+            benchmark::DoNotOptimize(filter.variance());
+        }
+        ++k;
+    }
+}
+
+template <std::size_t Window>
+void window_skewness(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    trial::online::window::moment_skewness<double, Window> filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.skewness());
+        ++k;
+    }
+}
+
+template <std::size_t Window>
+void window_kurtosis(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    trial::online::window::moment_kurtosis<double, Window> filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.kurtosis());
+        ++k;
+    }
+}
+
 BENCHMARK_TEMPLATE(window_mean, 2);
 BENCHMARK_TEMPLATE(window_variance, 2);
+BENCHMARK_TEMPLATE(window_variance_int, 2);
+BENCHMARK_TEMPLATE(window_lazy_variance, 2);
+BENCHMARK_TEMPLATE(window_skewness, 2);
+BENCHMARK_TEMPLATE(window_kurtosis, 2);
 
 BENCHMARK_TEMPLATE(window_mean, 16);
 BENCHMARK_TEMPLATE(window_variance, 16);
+BENCHMARK_TEMPLATE(window_variance_int, 16);
+BENCHMARK_TEMPLATE(window_lazy_variance, 16);
+BENCHMARK_TEMPLATE(window_skewness, 16);
+BENCHMARK_TEMPLATE(window_kurtosis, 16);
 
 BENCHMARK_TEMPLATE(window_mean, 256);
 BENCHMARK_TEMPLATE(window_variance, 256);
+BENCHMARK_TEMPLATE(window_variance_int, 256);
+BENCHMARK_TEMPLATE(window_lazy_variance, 256);
+BENCHMARK_TEMPLATE(window_skewness, 256);
+BENCHMARK_TEMPLATE(window_kurtosis, 256);
 
 BENCHMARK_TEMPLATE(window_mean, 4096);
 BENCHMARK_TEMPLATE(window_variance, 4096);
+BENCHMARK_TEMPLATE(window_variance_int, 4096);
+BENCHMARK_TEMPLATE(window_lazy_variance, 4096);
+BENCHMARK_TEMPLATE(window_skewness, 4096);
+BENCHMARK_TEMPLATE(window_kurtosis, 4096);
+
+BENCHMARK_TEMPLATE(window_variance_storage, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(window_variance_storage, float)->Arg(1 << 16);
+
+void window_three_variance(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    trial::online::window::moment_variance<double, 64> short_filter;
+    trial::online::window::moment_variance<double, 320> medium_filter;
+    trial::online::window::moment_variance<double, 960> long_filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        const auto input = values[k % values.size()];
+        short_filter.push(input);
+        medium_filter.push(input);
+        long_filter.push(input);
+        benchmark::DoNotOptimize(long_filter.variance());
+        ++k;
+    }
+}
+
+void window_multi_variance(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    trial::online::window::multi_moment_variance<double, 64, 320, 960> filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.variance(2));
+        ++k;
+    }
+}
+
+BENCHMARK(window_three_variance);
+BENCHMARK(window_multi_variance);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <trial/online/window/quantile.hpp>
+
+const std::size_t datasize = 1<<15;
+
+template <typename T>
+std::vector<T> dataset(std::size_t size)
+{
+    std::vector<T> values(size);
+    std::random_device device;
+    std::default_random_engine generator(device());
+    std::normal_distribution<T> distribution(0.0);
+    std::generate(values.begin(), values.end(), [&] { return distribution(generator); });
+    return values;
+}
+
+template <std::size_t Window>
+void window_median(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    trial::online::window::median<double, Window> filter;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.value());
+        ++k;
+    }
+}
+
+BENCHMARK_TEMPLATE(window_median, 16);
+BENCHMARK_TEMPLATE(window_median, 256);
+BENCHMARK_TEMPLATE(window_median, 4096);
+
+void window_median_dynamic(benchmark::State& state)
+{
+    auto values = dataset<double>(datasize);
+    trial::online::window::median<double, trial::online::dynamic_extent> filter(state.range(0));
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        filter.push(values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.value());
+        ++k;
+    }
+}
+
+BENCHMARK(window_median_dynamic)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
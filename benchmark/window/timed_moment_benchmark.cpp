@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <trial/online/window/timed_moment.hpp>
+
+const std::size_t datasize = 1<<15;
+
+template <typename T>
+std::vector<T> dataset(std::size_t size)
+{
+    std::vector<T> values(size);
+    std::random_device device;
+    std::default_random_engine generator(device());
+    std::normal_distribution<T> distribution(0.0);
+    std::generate(values.begin(), values.end(), [&] { return distribution(generator); });
+    return values;
+}
+
+// Window contains the given number of inputs at one input per microsecond
+void timed_variance(benchmark::State& state)
+{
+    using namespace trial::online;
+    auto values = dataset<double>(datasize);
+    window::timed_moment_variance<double> filter(std::chrono::microseconds(state.range(0)));
+    std::chrono::steady_clock::time_point now;
+    std::size_t k = 0;
+    for (auto _ : state)
+    {
+        now += std::chrono::microseconds(1);
+        filter.push(now, values[k % values.size()]);
+        benchmark::DoNotOptimize(filter.variance());
+        ++k;
+    }
+}
+
+BENCHMARK(timed_variance)->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,280 @@
+#ifndef TRIAL_ONLINE_CIRCULAR_ARRAY_HPP
+#define TRIAL_ONLINE_CIRCULAR_ARRAY_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <trial/online/circular_span.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace detail
+{
+
+template <typename T, std::size_t N>
+struct circular_array_storage
+{
+    using size_type = std::size_t;
+
+    T* data() noexcept { return member; }
+    const T* data() const noexcept { return member; }
+    static constexpr size_type capacity() noexcept { return N; }
+    static constexpr size_type mask() noexcept { return circular_mask(N); }
+
+    T member[N];
+};
+
+template <typename T>
+struct circular_array_storage<T, dynamic_extent>
+{
+    using size_type = std::size_t;
+
+    explicit circular_array_storage(size_type capacity);
+    template <typename ContiguousIterator>
+    circular_array_storage(ContiguousIterator begin, ContiguousIterator end) noexcept;
+    circular_array_storage(const circular_array_storage&);
+    circular_array_storage(circular_array_storage&&) noexcept = default;
+    circular_array_storage& operator= (const circular_array_storage&);
+    circular_array_storage& operator= (circular_array_storage&&) noexcept = default;
+
+    T* data() noexcept { return member.data; }
+    const T* data() const noexcept { return member.data; }
+    size_type capacity() const noexcept { return member.capacity; }
+    size_type mask() const noexcept { return member.mask; }
+
+    std::vector<T> owned;
+    struct
+    {
+        T* data;
+        size_type capacity;
+        size_type mask;
+    } member;
+};
+
+} // namespace detail
+
+//! @brief Circular buffer with embedded storage.
+//!
+//! Has the same interface as circular_span, but owns its elements and keeps
+//! positions as indices rather than pointers. With a fixed capacity @c N the
+//! circular array is trivially copyable if @c T is, so it can be copied with
+//! memcpy or relocated without fixups.
+//!
+//! With @c N equal to @c dynamic_extent the capacity is given at construction
+//! and the elements are stored on the heap or in externally supplied storage.
+//! Copies of heap-allocated arrays are deep, whereas copies of arrays with
+//! external storage refer to the same storage.
+
+template <typename T, std::size_t N = dynamic_extent>
+class circular_array
+{
+    static_assert(N > 0, "N must be larger than zero");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using pointer = typename std::add_pointer<value_type>::type;
+    using const_pointer = typename std::add_pointer<typename std::add_const<value_type>::type>::type;
+    using reference = typename std::add_lvalue_reference<value_type>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<value_type>::type>::type;
+
+    //! @brief Creates circular array with fixed capacity.
+    circular_array() noexcept = default;
+
+    //! @brief Creates circular array with dynamic capacity.
+    //!
+    //! The elements are allocated on the heap.
+    explicit circular_array(size_type capacity);
+
+    //! @brief Creates circular array with dynamic capacity.
+    //!
+    //! The elements are stored in the range from @c begin to @c end. The range
+    //! must outlive the circular array.
+    template <typename ContiguousIterator>
+    circular_array(ContiguousIterator begin,
+                   ContiguousIterator end) noexcept;
+
+    circular_array(const circular_array&) = default;
+    circular_array(circular_array&&) noexcept = default;
+    circular_array& operator= (const circular_array&) = default;
+    circular_array& operator= (circular_array&&) noexcept = default;
+    //! @brief Clears array and inserts elements at end of array.
+    circular_array& operator= (std::initializer_list<value_type>) noexcept(std::is_nothrow_copy_assignable<T>::value);
+
+    //! @brief Checks if array is empty.
+    bool empty() const noexcept;
+
+    //! @brief Checks if array is full.
+    bool full() const noexcept;
+
+    //! @brief Returns the maximum possible number of elements in array.
+    size_type capacity() const noexcept;
+
+    //! @brief Returns the number of elements in array.
+    size_type size() const noexcept;
+
+    //! @brief Returns reference to element at position from front of array.
+    reference operator[] (size_type position) noexcept;
+    const_reference operator[] (size_type position) const noexcept;
+
+    //! @brief Returns reference to first element in array.
+    const_reference front() const noexcept;
+
+    //! @brief Returns reference to last element in array.
+    const_reference back() const noexcept;
+
+    //! @brief Clears the array.
+    //!
+    //! The content of the underlying storage is not modified.
+    void clear() noexcept;
+
+    //! @brief Clears array and inserts elements at end of array.
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<T>::value);
+
+    //! @brief Clears array and inserts elements at end of array.
+    void assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<T>::value);
+
+    //! @brief Inserts element at beginning of array.
+    void push_front(value_type input) noexcept(std::is_nothrow_move_assignable<T>::value);
+
+    //! @brief Inserts element at end of array.
+    void push_back(value_type input) noexcept(std::is_nothrow_move_assignable<T>::value);
+
+    //! @brief Inserts elements at end of array.
+    //!
+    //! Only the last capacity() elements of the range are retained. They are
+    //! copied in at most two contiguous segments.
+    template <typename ForwardIterator>
+    void push_back(ForwardIterator first, ForwardIterator last) noexcept(std::is_nothrow_copy_assignable<T>::value);
+
+    //! @brief Erases element from beginning of array
+    void pop_front() noexcept;
+
+    //! @brief Erases element from end of array
+    void pop_back() noexcept;
+
+    //! @brief Returns first contiguous segment of array.
+    //!
+    //! The segment starts with the front element. Together with array_two()
+    //! it covers all elements in order.
+    std::pair<pointer, size_type> array_one() noexcept;
+    std::pair<const_pointer, size_type> array_one() const noexcept;
+
+    //! @brief Returns second contiguous segment of array.
+    //!
+    //! The segment is empty unless the elements wrap around the end of the
+    //! underlying storage.
+    std::pair<pointer, size_type> array_two() noexcept;
+    std::pair<const_pointer, size_type> array_two() const noexcept;
+
+private:
+    template <typename U>
+    struct basic_iterator
+    {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = U;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::add_pointer<value_type>::type;
+        using reference = typename std::add_lvalue_reference<value_type>::type;
+        using iterator_type = basic_iterator<value_type>;
+        using parent_pointer = typename std::conditional<std::is_const<value_type>::value,
+                                                         const circular_array<T, N> *,
+                                                         circular_array<T, N> *>::type;
+
+        basic_iterator() = default;
+        basic_iterator(const basic_iterator&) = default;
+        basic_iterator(basic_iterator&&) = default;
+        basic_iterator& operator= (const basic_iterator&) = default;
+        basic_iterator& operator= (basic_iterator&&) = default;
+
+        iterator_type& operator++ () noexcept;
+        iterator_type operator++ (int) noexcept;
+        iterator_type& operator-- () noexcept;
+        iterator_type operator-- (int) noexcept;
+
+        iterator_type& operator+= (difference_type) noexcept;
+        iterator_type& operator-= (difference_type) noexcept;
+        iterator_type operator+ (difference_type) const noexcept;
+        iterator_type operator- (difference_type) const noexcept;
+        difference_type operator- (const iterator_type&) const noexcept;
+
+        friend iterator_type operator+ (difference_type amount, const iterator_type& other) noexcept
+        {
+            return other + amount;
+        }
+
+        pointer operator-> () const noexcept;
+        reference operator* () const noexcept;
+
+        reference operator[] (difference_type) const noexcept;
+
+        bool operator== (const iterator_type&) const noexcept;
+        bool operator!= (const iterator_type&) const noexcept;
+        bool operator< (const iterator_type&) const noexcept;
+        bool operator<= (const iterator_type&) const noexcept;
+        bool operator> (const iterator_type&) const noexcept;
+        bool operator>= (const iterator_type&) const noexcept;
+
+    private:
+        friend class circular_array<T, N>;
+
+        difference_type offset() const noexcept;
+
+        basic_iterator(parent_pointer parent, const size_type index);
+
+    private:
+        parent_pointer parent;
+        size_type current;
+    };
+
+public:
+    using iterator = basic_iterator<value_type>;
+    using const_iterator = basic_iterator<const value_type>;
+
+    //! @brief Returns iterator to the beginning of the array.
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+
+    //! @brief Returns iterator to the ending of the array.
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
+
+private:
+    size_type index(size_type) const noexcept;
+    size_type vindex(size_type) const noexcept;
+    reference at(size_type) noexcept;
+    const_reference at(size_type) const noexcept;
+
+private:
+    detail::circular_array_storage<value_type, N> storage;
+    struct
+    {
+        size_type size = 0;
+        size_type next = 0;
+    } member;
+};
+
+} // namespace online
+} // namespace trial
+
+#include <trial/online/detail/circular_array.ipp>
+
+#endif // TRIAL_ONLINE_CIRCULAR_ARRAY_HPP
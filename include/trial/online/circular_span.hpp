@@ -15,12 +15,27 @@
 #include <type_traits>
 #include <initializer_list>
 #include <iterator>
+#include <utility>
 
 namespace trial
 {
 namespace online
 {
 
+//! @brief Extent used to select a capacity that is given at run-time.
+constexpr std::size_t dynamic_extent = std::size_t(-1);
+
+namespace detail
+{
+
+//! @brief Returns index mask for power-of-two capacities, otherwise zero.
+constexpr std::size_t circular_mask(std::size_t capacity) noexcept
+{
+    return (capacity > 1 && (capacity & (capacity - 1)) == 0) ? capacity - 1 : 0;
+}
+
+} // namespace detail
+
 // FIXME: Partly inspired by boost::circular_buffer and http://wg21.link/p0059
 
 template <typename T>
@@ -30,6 +45,7 @@ public:
     using value_type = T;
     using size_type = std::size_t;
     using pointer = typename std::add_pointer<value_type>::type;
+    using const_pointer = typename std::add_pointer<typename std::add_const<value_type>::type>::type;
     using reference = typename std::add_lvalue_reference<value_type>::type;
     using const_reference = typename std::add_const<reference>::type;
 
@@ -74,6 +90,10 @@ public:
     //! @brief Returns the number of elements in span.
     size_type size() const noexcept;
 
+    //! @brief Returns reference to element at position from front of span.
+    reference operator[] (size_type position) noexcept;
+    const_reference operator[] (size_type position) const noexcept;
+
     //! @brief Returns reference to first element in span.
     const_reference front() const noexcept;
 
@@ -98,17 +118,38 @@ public:
     //! @brief Inserts element at end of span.
     void push_back(value_type input) noexcept(std::is_nothrow_move_assignable<T>::value);
 
+    //! @brief Inserts elements at end of span.
+    //!
+    //! Only the last capacity() elements of the range are retained. They are
+    //! copied in at most two contiguous segments.
+    template <typename ForwardIterator>
+    void push_back(ForwardIterator first, ForwardIterator last) noexcept(std::is_nothrow_copy_assignable<T>::value);
+
     //! @brief Erases element from beginning of span
     void pop_front() noexcept;
 
     //! @brief Erases element from end of span
     void pop_back() noexcept;
 
+    //! @brief Returns first contiguous segment of span.
+    //!
+    //! The segment starts with the front element. Together with array_two()
+    //! it covers all elements in order.
+    std::pair<pointer, size_type> array_one() noexcept;
+    std::pair<const_pointer, size_type> array_one() const noexcept;
+
+    //! @brief Returns second contiguous segment of span.
+    //!
+    //! The segment is empty unless the elements wrap around the end of the
+    //! underlying storage.
+    std::pair<pointer, size_type> array_two() noexcept;
+    std::pair<const_pointer, size_type> array_two() const noexcept;
+
 private:
     template <typename U>
     struct basic_iterator
     {
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using value_type = U;
         using difference_type = std::ptrdiff_t;
         using pointer = typename std::add_pointer<value_type>::type;
@@ -124,16 +165,37 @@ private:
 
         iterator_type& operator++ () noexcept;
         iterator_type operator++ (int) noexcept;
+        iterator_type& operator-- () noexcept;
+        iterator_type operator-- (int) noexcept;
+
+        iterator_type& operator+= (difference_type) noexcept;
+        iterator_type& operator-= (difference_type) noexcept;
+        iterator_type operator+ (difference_type) const noexcept;
+        iterator_type operator- (difference_type) const noexcept;
+        difference_type operator- (const iterator_type&) const noexcept;
+
+        friend iterator_type operator+ (difference_type amount, const iterator_type& other) noexcept
+        {
+            return other + amount;
+        }
 
         pointer operator-> () noexcept;
         const_reference operator* () const noexcept;
 
+        const_reference operator[] (difference_type) const noexcept;
+
         bool operator== (const iterator_type&) const noexcept;
         bool operator!= (const iterator_type&) const noexcept;
+        bool operator< (const iterator_type&) const noexcept;
+        bool operator<= (const iterator_type&) const noexcept;
+        bool operator> (const iterator_type&) const noexcept;
+        bool operator>= (const iterator_type&) const noexcept;
 
     private:
         friend class circular_span<T>;
 
+        difference_type offset() const noexcept;
+
         basic_iterator(const circular_span<T> *parent, const size_type index);
 
     private:
@@ -166,6 +228,7 @@ private:
     {
         const pointer data;
         const size_type capacity;
+        const size_type mask;
         size_type size;
         size_type next;
     } member;
@@ -38,14 +38,25 @@ public:
     void clear() noexcept;
     void push(value_type, value_type) noexcept;
 
+    //! @brief Merges data points from other filter.
+
+    basic_comoment& operator+= (const basic_comoment&) noexcept;
+
     size_type size() const noexcept;
     value_type variance() const noexcept;
     value_type unbiased_variance() const noexcept;
 
 protected:
-    cumulative::basic_moment<value_type, with::mean> x_center;
-    cumulative::basic_moment<value_type, with::mean> y_center;
-    value_type center {0};
+    struct
+    {
+        value_type x_mean = value_type(0);
+        value_type y_mean = value_type(0);
+        size_type count = 0;
+    } member;
+    struct
+    {
+        value_type xy = value_type(0);
+    } sum;
 };
 
 // Convenience
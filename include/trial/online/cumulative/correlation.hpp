@@ -22,14 +22,22 @@ namespace online
 namespace cumulative
 {
 
+//! @brief Online Pearson correlation coefficient.
+//!
+//! Keeps a single bivariate state with the count, the x and y means, and
+//! the x, y, and xy second-order sums.
+
 template <typename T>
 class correlation
+    : protected basic_comoment<T, with::variance>
 {
     static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
 
+    using super = basic_comoment<T, with::variance>;
+
 public:
-    using value_type = T;
-    using size_type = std::size_t;
+    using typename super::value_type;
+    using typename super::size_type;
 
     //! @brief Resets filter.
 
@@ -39,6 +47,10 @@ public:
 
     void push(value_type, value_type) noexcept;
 
+    //! @brief Merges data points from other filter.
+
+    correlation& operator+= (const correlation&) noexcept;
+
     //! @brief Returns number of data points.
 
     size_type size() const noexcept;
@@ -50,9 +62,11 @@ public:
     value_type value() const noexcept;
 
 private:
-    basic_comoment<value_type, with::variance> co_moment;
-    basic_moment<value_type, with::variance> x_moment;
-    basic_moment<value_type, with::variance> y_moment;
+    struct
+    {
+        value_type x = value_type(0);
+        value_type y = value_type(0);
+    } sum;
 };
 
 } // namespace cumulative
@@ -8,8 +8,6 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <cassert>
-
 namespace trial
 {
 namespace online
@@ -24,33 +22,55 @@ namespace cumulative
 template <typename T>
 void basic_comoment<T, with::variance>::clear() noexcept
 {
-    x_center.clear();
-    y_center.clear();
-    center = value_type(0);
+    member.x_mean = value_type(0);
+    member.y_mean = value_type(0);
+    member.count = size_type(0);
+    sum.xy = value_type(0);
 }
 
 template <typename T>
 void basic_comoment<T, with::variance>::push(value_type x, value_type y) noexcept
 {
-    // Using new x moment and old y moment
-    x_center.push(x);
-    center += (x - x_center.mean()) * (y - y_center.mean());
-    y_center.push(y);
+    // Using new x mean and old y mean
+    ++member.count;
+    const auto y_delta = y - member.y_mean;
+    member.x_mean += (x - member.x_mean) / value_type(member.count);
+    member.y_mean += y_delta / value_type(member.count);
+    sum.xy += (x - member.x_mean) * y_delta;
 }
 
 template <typename T>
-auto basic_comoment<T, with::variance>::size() const noexcept -> size_type
+auto basic_comoment<T, with::variance>::operator+= (const basic_comoment& other) noexcept -> basic_comoment&
 {
-    assert(x_center.size() == y_center.size());
+    if (other.size() == 0)
+        return *this;
+
+    // Use old means
+    const value_type count(size());
+    const value_type other_count(other.size());
+    const auto n = count + other_count;
+    const auto x_delta = other.member.x_mean - member.x_mean;
+    const auto y_delta = other.member.y_mean - member.y_mean;
 
-    return x_center.size();
+    sum.xy += other.sum.xy + x_delta * y_delta * count * other_count / n;
+
+    member.count += other.member.count;
+    member.x_mean += x_delta * other_count / n;
+    member.y_mean += y_delta * other_count / n;
+    return *this;
+}
+
+template <typename T>
+auto basic_comoment<T, with::variance>::size() const noexcept -> size_type
+{
+    return member.count;
 }
 
 template <typename T>
 auto basic_comoment<T, with::variance>::variance() const noexcept -> value_type
 {
     if (size() > 0)
-        return center / size();
+        return sum.xy / size();
     return value_type(0);
 }
 
@@ -59,7 +79,7 @@ auto covariance<T>::unbiased_variance() const noexcept -> value_type
 {
     // With Bessel's correction
     if (size() > 1)
-        return center / (size() - 1);
+        return sum.xy / (size() - 1);
     return value_type(0);
 }
 
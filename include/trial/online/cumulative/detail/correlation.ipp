@@ -21,32 +21,56 @@ namespace cumulative
 template <typename T>
 void correlation<T>::clear() noexcept
 {
-    co_moment.clear();
-    x_moment.clear();
-    y_moment.clear();
+    super::clear();
+    sum.x = value_type(0);
+    sum.y = value_type(0);
 }
 
 template <typename T>
 auto correlation<T>::size() const noexcept -> size_type
 {
-    return co_moment.size();
+    return super::size();
 }
 
 template <typename T>
 void correlation<T>::push(value_type x, value_type y) noexcept
 {
-    co_moment.push(x, y);
-    x_moment.push(x);
-    y_moment.push(y);
+    // Use old means
+    const auto x_delta = x - super::member.x_mean;
+    const auto y_delta = y - super::member.y_mean;
+    super::push(x, y);
+    sum.x += x_delta * (x - super::member.x_mean);
+    sum.y += y_delta * (y - super::member.y_mean);
+}
+
+template <typename T>
+auto correlation<T>::operator+= (const correlation& other) noexcept -> correlation&
+{
+    if (other.size() == 0)
+        return *this;
+
+    // Use old means
+    const value_type count(size());
+    const value_type other_count(other.size());
+    const auto n = count + other_count;
+    const auto x_delta = other.super::member.x_mean - super::member.x_mean;
+    const auto y_delta = other.super::member.y_mean - super::member.y_mean;
+
+    sum.x += other.sum.x + x_delta * x_delta * count * other_count / n;
+    sum.y += other.sum.y + y_delta * y_delta * count * other_count / n;
+
+    super::operator+=(other);
+    return *this;
 }
 
 template <typename T>
 auto correlation<T>::value() const noexcept -> value_type
 {
-    const value_type variance_product = x_moment.variance() * y_moment.variance();
+    const value_type count(size());
+    const value_type variance_product = (sum.x / count) * (sum.y / count);
     if (variance_product < std::numeric_limits<value_type>::epsilon())
         return value_type(1);
-    return co_moment.variance() / std::sqrt(variance_product);
+    return super::variance() / std::sqrt(variance_product);
 }
 
 } // namespace cumulative
@@ -60,6 +60,37 @@ void basic_moment<T, with::mean>::push(value_type input) noexcept
     member.mean += (input - member.mean) / value_type(member.count);
 }
 
+template <typename T>
+template <typename ForwardIterator>
+void basic_moment<T, with::mean>::push(ForwardIterator first, ForwardIterator last) noexcept
+{
+    // Accumulate integers in a wider type to avoid overflow
+    basic_moment block;
+    sum_type total(0);
+    for (; first != last; ++first)
+    {
+        total += *first;
+        ++block.member.count;
+    }
+    if (block.empty())
+        return;
+
+    block.member.mean = value_type(total / sum_type(block.member.count));
+    operator+=(block);
+}
+
+template <typename T>
+auto basic_moment<T, with::mean>::operator+= (const basic_moment& other) noexcept -> basic_moment&
+{
+    if (other.empty())
+        return *this;
+
+    member.count += other.member.count;
+    const auto delta = sum_type(other.member.mean) - sum_type(member.mean);
+    member.mean = value_type(sum_type(member.mean) + delta * sum_type(other.member.count) / sum_type(member.count));
+    return *this;
+}
+
 //-----------------------------------------------------------------------------
 // Mean with variance
 //-----------------------------------------------------------------------------
@@ -91,6 +122,41 @@ void basic_moment<T, with::variance>::push(value_type input) noexcept
     sum.variance += diff * (input - super::mean());
 }
 
+template <typename T>
+template <typename ForwardIterator>
+void basic_moment<T, with::variance>::push(ForwardIterator first, ForwardIterator last) noexcept
+{
+    basic_moment block;
+    block.super::push(first, last);
+    const auto mean = block.mean();
+    for (; first != last; ++first)
+    {
+        const auto delta = *first - mean;
+        block.sum.variance += delta * delta;
+    }
+    operator+=(block);
+}
+
+template <typename T>
+auto basic_moment<T, with::variance>::operator+= (const basic_moment& other) noexcept -> basic_moment&
+{
+    if (other.empty())
+        return *this;
+
+    using sum_type = typename super::sum_type;
+
+    // Use old sums
+    const sum_type count(super::size());
+    const sum_type other_count(other.size());
+    const auto n = count + other_count;
+    const auto delta = sum_type(other.mean()) - sum_type(super::mean());
+
+    sum.variance = value_type(sum_type(sum.variance) + (sum_type(other.sum.variance) + delta * delta * count * other_count / n));
+
+    super::operator+=(other);
+    return *this;
+}
+
 //-----------------------------------------------------------------------------
 // Mean with variance and skewness
 //-----------------------------------------------------------------------------
@@ -105,7 +171,7 @@ void basic_moment<T, with::skewness>::clear() noexcept
 template <typename T>
 auto basic_moment<T, with::skewness>::skewness() const noexcept -> value_type
 {
-    if (sum.skewness < std::numeric_limits<value_type>::epsilon())
+    if (std::abs(sum.skewness) < std::numeric_limits<value_type>::epsilon())
         return value_type(0);
     return std::sqrt(super::size()) * sum.skewness / (std::sqrt(super::sum.variance) * super::sum.variance);
 }
@@ -116,7 +182,7 @@ auto basic_moment<T, with::skewness>::unbiased_skewness() const noexcept -> valu
     const auto count = size();
     if (count < 2)
         return value_type(0);
-    if (sum.skewness < std::numeric_limits<value_type>::epsilon())
+    if (std::abs(sum.skewness) < std::numeric_limits<value_type>::epsilon())
         return value_type(0);
     // Bias-correction from Octave manual
     return skewness() * std::sqrt(count * (count - 1)) / value_type(count - 2);
@@ -136,6 +202,44 @@ void basic_moment<T, with::skewness>::push(value_type input) noexcept
     super::push(input);
 }
 
+template <typename T>
+template <typename ForwardIterator>
+void basic_moment<T, with::skewness>::push(ForwardIterator first, ForwardIterator last) noexcept
+{
+    basic_moment block;
+    block.super::super::push(first, last);
+    const auto mean = block.mean();
+    for (; first != last; ++first)
+    {
+        const auto delta = *first - mean;
+        const auto delta_squared = delta * delta;
+        block.super::sum.variance += delta_squared;
+        block.sum.skewness += delta_squared * delta;
+    }
+    operator+=(block);
+}
+
+template <typename T>
+auto basic_moment<T, with::skewness>::operator+= (const basic_moment& other) noexcept -> basic_moment&
+{
+    if (other.empty())
+        return *this;
+
+    // Use old sums
+    const value_type count(super::size());
+    const value_type other_count(other.size());
+    const auto n = count + other_count;
+    const auto delta = other.mean() - super::mean();
+    const auto delta_over_n = delta / n;
+
+    const auto expr = delta * delta_over_n * delta_over_n * count * other_count * (count - other_count);
+    const auto var_expr = value_type(3) * delta_over_n * (count * other.super::sum.variance - other_count * super::sum.variance);
+    sum.skewness += other.sum.skewness + expr + var_expr;
+
+    super::operator+=(other);
+    return *this;
+}
+
 //-----------------------------------------------------------------------------
 // Mean with variance, skewness, and kurtosis
 //-----------------------------------------------------------------------------
@@ -184,6 +288,47 @@ void basic_moment<T, with::kurtosis>::push(value_type input) noexcept
     super::push(input);
 }
 
+template <typename T>
+template <typename ForwardIterator>
+void basic_moment<T, with::kurtosis>::push(ForwardIterator first, ForwardIterator last) noexcept
+{
+    basic_moment block;
+    block.super::super::super::push(first, last);
+    const auto mean = block.mean();
+    for (; first != last; ++first)
+    {
+        const auto delta = *first - mean;
+        const auto delta_squared = delta * delta;
+        block.super::super::sum.variance += delta_squared;
+        block.super::sum.skewness += delta_squared * delta;
+        block.sum.kurtosis += delta_squared * delta_squared;
+    }
+    operator+=(block);
+}
+
+template <typename T>
+auto basic_moment<T, with::kurtosis>::operator+= (const basic_moment& other) noexcept -> basic_moment&
+{
+    if (other.empty())
+        return *this;
+
+    // Use old sums
+    const value_type count(super::size());
+    const value_type other_count(other.size());
+    const auto n = count + other_count;
+    const auto delta = other.mean() - super::mean();
+    const auto delta_over_n = delta / n;
+    const auto delta_over_n_squared = delta_over_n * delta_over_n;
+
+    const auto expr = delta * delta_over_n * delta_over_n_squared * count * other_count * (count * count - count * other_count + other_count * other_count);
+    const auto var_expr = value_type(6) * delta_over_n_squared * (count * count * other.super::super::sum.variance + other_count * other_count * super::super::sum.variance);
+    const auto skewness_expr = value_type(4) * delta_over_n * (count * other.super::sum.skewness - other_count * super::sum.skewness);
+    sum.kurtosis += other.sum.kurtosis + expr + var_expr + skewness_expr;
+
+    super::operator+=(other);
+    return *this;
+}
+
 } // namespace cumulative
 } // namespace online
 } // namespace trial
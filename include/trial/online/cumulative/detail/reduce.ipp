@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace trial
+{
+namespace online
+{
+namespace detail
+{
+
+// Invokes function(begin, end) concurrently on consecutive index chunks and
+// merges the returned filters in chunk order.
+
+template <typename Filter, typename Function>
+Filter reduce_partitions(std::launch policy,
+                         std::ptrdiff_t length,
+                         std::size_t partitions,
+                         Function function)
+{
+    const std::ptrdiff_t count = std::max(std::ptrdiff_t(1),
+                                          std::min(std::ptrdiff_t(partitions), length));
+
+    std::vector<std::future<Filter>> tasks;
+    tasks.reserve(count);
+    for (std::ptrdiff_t k = 0; k < count; ++k)
+    {
+        tasks.push_back(std::async(policy,
+                                   function,
+                                   length * k / count,
+                                   length * (k + 1) / count));
+    }
+
+    Filter result;
+    for (auto& task : tasks)
+    {
+        result += task.get();
+    }
+    return result;
+}
+
+} // namespace detail
+
+namespace cumulative
+{
+
+template <typename Filter, typename RandomAccessIterator>
+Filter reduce(std::launch policy,
+              RandomAccessIterator first,
+              RandomAccessIterator last,
+              std::size_t partitions)
+{
+    return detail::reduce_partitions<Filter>(
+        policy,
+        std::distance(first, last),
+        partitions,
+        [first] (std::ptrdiff_t begin, std::ptrdiff_t end)
+        {
+            Filter filter;
+            filter.push(first + begin, first + end);
+            return filter;
+        });
+}
+
+template <typename Filter, typename RandomAccessIterator>
+Filter reduce(std::launch policy,
+              RandomAccessIterator first,
+              RandomAccessIterator last)
+{
+    return reduce<Filter>(policy, first, last, std::thread::hardware_concurrency());
+}
+
+template <typename Filter, typename XRandomAccessIterator, typename YRandomAccessIterator>
+Filter reduce(std::launch policy,
+              XRandomAccessIterator x_first,
+              XRandomAccessIterator x_last,
+              YRandomAccessIterator y_first,
+              std::size_t partitions)
+{
+    return detail::reduce_partitions<Filter>(
+        policy,
+        std::distance(x_first, x_last),
+        partitions,
+        [x_first, y_first] (std::ptrdiff_t begin, std::ptrdiff_t end)
+        {
+            Filter filter;
+            auto x = x_first + begin;
+            auto y = y_first + begin;
+            for (auto k = begin; k < end; ++k)
+            {
+                filter.push(*x, *y);
+                ++x;
+                ++y;
+            }
+            return filter;
+        });
+}
+
+template <typename Filter, typename XRandomAccessIterator, typename YRandomAccessIterator>
+auto reduce(std::launch policy,
+            XRandomAccessIterator x_first,
+            XRandomAccessIterator x_last,
+            YRandomAccessIterator y_first)
+    -> typename std::enable_if<!std::is_integral<YRandomAccessIterator>::value, Filter>::type
+{
+    return reduce<Filter>(policy, x_first, x_last, y_first, std::thread::hardware_concurrency());
+}
+
+} // namespace cumulative
+} // namespace online
+} // namespace trial
@@ -8,7 +8,6 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <cassert>
 #include <limits>
 
 namespace trial
@@ -21,40 +20,56 @@ namespace cumulative
 template <typename T>
 void regression<T>::clear() noexcept
 {
-    co_moment.clear();
-    x_moment.clear();
-    y_moment.clear();
+    super::clear();
+    sum.x = value_type(0);
 }
 
 template <typename T>
 auto regression<T>::size() const noexcept -> size_type
 {
-    assert(x_moment.size() == y_moment.size());
-
-    return x_moment.size();
+    return super::size();
 }
 
 template <typename T>
 void regression<T>::push(value_type x, value_type y) noexcept
 {
-    co_moment.push(x, y);
-    x_moment.push(x);
-    y_moment.push(y);
+    // Use old mean
+    const auto x_delta = x - super::member.x_mean;
+    super::push(x, y);
+    sum.x += x_delta * (x - super::member.x_mean);
+}
+
+template <typename T>
+auto regression<T>::operator+= (const regression& other) noexcept -> regression&
+{
+    if (other.size() == 0)
+        return *this;
+
+    // Use old means
+    const value_type count(size());
+    const value_type other_count(other.size());
+    const auto x_delta = other.super::member.x_mean - super::member.x_mean;
+
+    sum.x += other.sum.x + x_delta * x_delta * count * other_count / (count + other_count);
+
+    super::operator+=(other);
+    return *this;
 }
 
 template <typename T>
 auto regression<T>::at(value_type position) const noexcept -> value_type
 {
-    return y_moment.mean() - slope() * (x_moment.mean() - position);
+    return super::member.y_mean - slope() * (super::member.x_mean - position);
 }
 
 template <typename T>
 auto regression<T>::slope() const noexcept -> value_type
 {
-    const auto divisor = x_moment.variance();
+    // Ratio of covariance and x variance where the common count cancels out
+    const auto divisor = sum.x;
     return (divisor == 0)
         ? value_type(0)
-        : co_moment.variance() / divisor;
+        : super::sum.xy / divisor;
 }
 
 } // namespace cumulative
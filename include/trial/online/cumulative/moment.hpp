@@ -47,6 +47,23 @@ public:
 
     void push(value_type) noexcept;
 
+    //! @brief Merges data points from other filter.
+    //!
+    //! The result is the same as if all data points had been pushed onto
+    //! a single filter, except for rounding errors.
+
+    basic_moment& operator+= (const basic_moment&) noexcept;
+
+    //! @brief Appends data points.
+    //!
+    //! The data points are processed as a block in two passes; first the
+    //! block moments are calculated and then merged into the filter.
+    //!
+    //! @pre [first, last) is a forward range.
+
+    template <typename ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last) noexcept;
+
     //! @brief Returns number of data points.
 
     size_type size() const noexcept;
@@ -68,6 +85,9 @@ public:
     value_type unbiased_mean() const noexcept;
 
 protected:
+    // Integers are merged in floating-point to avoid overflow
+    using sum_type = typename std::conditional<std::is_integral<value_type>::value, double, value_type>::type;
+
     struct
     {
         value_type mean = 0;
@@ -96,6 +116,17 @@ public:
 
     void push(value_type) noexcept;
 
+    //! @brief Appends data points.
+    //!
+    //! @pre [first, last) is a forward range.
+
+    template <typename ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last) noexcept;
+
+    //! @brief Merges data points from other filter.
+
+    basic_moment& operator+= (const basic_moment&) noexcept;
+
     using super::size;
     using super::empty;
     using super::mean;
@@ -135,6 +166,9 @@ public:
 
     void clear() noexcept;
     void push(value_type) noexcept;
+    template <typename ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last) noexcept;
+    basic_moment& operator+= (const basic_moment&) noexcept;
 
     using super::size;
     using super::empty;
@@ -167,6 +201,9 @@ public:
 
     void clear() noexcept;
     void push(value_type) noexcept;
+    template <typename ForwardIterator>
+    void push(ForwardIterator first, ForwardIterator last) noexcept;
+    basic_moment& operator+= (const basic_moment&) noexcept;
 
     using super::size;
     using super::empty;
@@ -0,0 +1,81 @@
+#ifndef TRIAL_ONLINE_CUMULATIVE_REDUCE_HPP
+#define TRIAL_ONLINE_CUMULATIVE_REDUCE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef> // std::size_t
+#include <future>
+#include <type_traits>
+
+namespace trial
+{
+namespace online
+{
+namespace cumulative
+{
+
+//! @brief Calculates filter over range with concurrent partitions.
+//!
+//! The range is split into @c partitions consecutive chunks of nearly equal
+//! size. Each chunk is pushed onto its own filter by a task launched with
+//! std::async using the given launch @c policy. The partial filters are
+//! merged in chunk order, so the result does not depend on the scheduling
+//! of the tasks.
+//!
+//! Filter must support push(first, last) and operator+=.
+//!
+//! @returns Filter containing all data points in range.
+//!
+//! @throws std::system_error if a task cannot be started.
+
+template <typename Filter, typename RandomAccessIterator>
+Filter reduce(std::launch policy,
+              RandomAccessIterator first,
+              RandomAccessIterator last,
+              std::size_t partitions);
+
+//! @brief Calculates filter over range with one partition per hardware thread.
+
+template <typename Filter, typename RandomAccessIterator>
+Filter reduce(std::launch policy,
+              RandomAccessIterator first,
+              RandomAccessIterator last);
+
+//! @brief Calculates bivariate filter over ranges with concurrent partitions.
+//!
+//! Data points are formed pairwise from [x_first, x_last) and the range of
+//! equal length starting at y_first.
+//!
+//! Filter must support push(x, y) and operator+=.
+
+template <typename Filter, typename XRandomAccessIterator, typename YRandomAccessIterator>
+Filter reduce(std::launch policy,
+              XRandomAccessIterator x_first,
+              XRandomAccessIterator x_last,
+              YRandomAccessIterator y_first,
+              std::size_t partitions);
+
+//! @brief Calculates bivariate filter over ranges with one partition per hardware thread.
+
+template <typename Filter, typename XRandomAccessIterator, typename YRandomAccessIterator>
+auto reduce(std::launch policy,
+            XRandomAccessIterator x_first,
+            XRandomAccessIterator x_last,
+            YRandomAccessIterator y_first)
+    -> typename std::enable_if<!std::is_integral<YRandomAccessIterator>::value, Filter>::type;
+
+} // namespace cumulative
+} // namespace online
+} // namespace trial
+
+#include <trial/online/cumulative/detail/reduce.ipp>
+
+#endif // TRIAL_ONLINE_CUMULATIVE_REDUCE_HPP
@@ -27,15 +27,21 @@ namespace cumulative
 //! @brief Online approximation of simple linear regression.
 //!
 //! Executes in constant time and space. No heap allocations are performed.
+//!
+//! Keeps a single bivariate state with the count, the x and y means, and
+//! the x and xy second-order sums.
 
 template <typename T>
 class regression
+    : protected basic_comoment<T, with::variance>
 {
     static_assert(std::is_floating_point<T>::value, "T must be an floating-point type");
 
+    using super = basic_comoment<T, with::variance>;
+
 public:
-    using value_type = T;
-    using size_type = std::size_t;
+    using typename super::value_type;
+    using typename super::size_type;
 
     //! @brief Resets filter.
 
@@ -49,6 +55,10 @@ public:
 
     void push(value_type x, value_type y) noexcept;
 
+    //! @brief Merges data points from other filter.
+
+    regression& operator+= (const regression&) noexcept;
+
     //! @brief Predicts value at postion.
     //!
     //! at(0) is the intercept where the regression line crosses the y axis.
@@ -68,9 +78,10 @@ public:
     value_type slope() const noexcept;
 
 private:
-    basic_comoment<value_type, with::variance> co_moment;
-    basic_moment<value_type, with::variance> x_moment;
-    basic_moment<value_type, with::variance> y_moment;
+    struct
+    {
+        value_type x = value_type(0);
+    } sum;
 };
 
 } // namespace cumulative
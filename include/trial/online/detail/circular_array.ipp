@@ -0,0 +1,524 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+#include <memory>
+
+namespace trial
+{
+namespace online
+{
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// circular_array_storage<T, dynamic_extent>
+//-----------------------------------------------------------------------------
+
+template <typename T>
+circular_array_storage<T, dynamic_extent>::circular_array_storage(size_type capacity)
+    : owned(capacity),
+      member{owned.data(), capacity, circular_mask(capacity)}
+{
+    assert(capacity > 0);
+}
+
+template <typename T>
+template <typename ContiguousIterator>
+circular_array_storage<T, dynamic_extent>::circular_array_storage(ContiguousIterator begin,
+                                                                  ContiguousIterator end) noexcept
+    : member{std::addressof(*begin),
+             size_type(std::distance(begin, end)),
+             circular_mask(std::distance(begin, end))}
+{
+    assert(member.capacity > 0);
+}
+
+template <typename T>
+circular_array_storage<T, dynamic_extent>::circular_array_storage(const circular_array_storage& other)
+    : owned(other.owned),
+      member{owned.empty() ? other.member.data : owned.data(), other.member.capacity, other.member.mask}
+{
+}
+
+template <typename T>
+auto circular_array_storage<T, dynamic_extent>::operator= (const circular_array_storage& other) -> circular_array_storage&
+{
+    owned = other.owned;
+    member.data = owned.empty() ? other.member.data : owned.data();
+    member.capacity = other.member.capacity;
+    member.mask = other.member.mask;
+    return *this;
+}
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+// circular_array<T, N>
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+circular_array<T, N>::circular_array(size_type capacity)
+    : storage(capacity)
+{
+    static_assert(N == dynamic_extent, "Capacity is fixed by template parameter");
+}
+
+template <typename T, std::size_t N>
+template <typename ContiguousIterator>
+circular_array<T, N>::circular_array(ContiguousIterator begin,
+                                     ContiguousIterator end) noexcept
+    : storage(begin, end)
+{
+    static_assert(N == dynamic_extent, "Capacity is fixed by template parameter");
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::operator= (std::initializer_list<value_type> input) noexcept(std::is_nothrow_copy_assignable<T>::value) -> circular_array&
+{
+    assign(std::move(input));
+    return *this;
+}
+
+template <typename T, std::size_t N>
+bool circular_array<T, N>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t N>
+bool circular_array<T, N>::full() const noexcept
+{
+    return size() == capacity();
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::capacity() const noexcept -> size_type
+{
+    return storage.capacity();
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::size() const noexcept -> size_type
+{
+    return member.size;
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::operator[] (size_type position) noexcept -> reference
+{
+    assert(position < size());
+
+    return at(member.next - member.size + position);
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::operator[] (size_type position) const noexcept -> const_reference
+{
+    assert(position < size());
+
+    return at(member.next - member.size + position);
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::front() const noexcept -> const_reference
+{
+    assert(!empty());
+
+    return at(member.next - member.size);
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::back() const noexcept -> const_reference
+{
+    assert(!empty());
+
+    return at(member.next - 1);
+}
+
+template <typename T, std::size_t N>
+void circular_array<T, N>::clear() noexcept
+{
+    member.size = 0;
+    member.next = 0;
+}
+
+template <typename T, std::size_t N>
+template <typename InputIterator>
+void circular_array<T, N>::assign(InputIterator first, InputIterator last) noexcept(std::is_nothrow_copy_assignable<T>::value)
+{
+    clear();
+    while (first != last)
+    {
+        push_back(*first);
+        ++first;
+    }
+}
+
+template <typename T, std::size_t N>
+void circular_array<T, N>::assign(std::initializer_list<value_type> input) noexcept(std::is_nothrow_move_assignable<T>::value)
+{
+    clear();
+    for (const auto& value : input)
+    {
+        push_back(std::move(value));
+    }
+}
+
+template <typename T, std::size_t N>
+void circular_array<T, N>::push_front(value_type input) noexcept(std::is_nothrow_move_assignable<T>::value)
+{
+    if (full())
+    {
+        member.next = capacity() + index(member.next) - 1;
+    }
+    else
+    {
+        ++member.size;
+    }
+    at(index(member.next) - member.size) = std::move(input);
+}
+
+template <typename T, std::size_t N>
+void circular_array<T, N>::push_back(value_type input) noexcept(std::is_nothrow_move_assignable<T>::value)
+{
+    at(member.next) = std::move(input);
+    member.next = capacity() + index(member.next) + 1;
+    if (!full())
+    {
+        ++member.size;
+    }
+}
+
+template <typename T, std::size_t N>
+template <typename ForwardIterator>
+void circular_array<T, N>::push_back(ForwardIterator first, ForwardIterator last) noexcept(std::is_nothrow_copy_assignable<T>::value)
+{
+    auto length = size_type(std::distance(first, last));
+    if (length == 0)
+        return;
+    if (length > capacity())
+    {
+        // Skip elements that would be overwritten anyway
+        std::advance(first, length - capacity());
+        length = capacity();
+    }
+    const auto start = index(member.next);
+    const auto head = std::min(length, capacity() - start);
+    auto middle = first;
+    std::advance(middle, head);
+    std::copy(first, middle, storage.data() + start);
+    std::copy(middle, last, storage.data());
+
+    member.next = capacity() + index(member.next + length - 1) + 1;
+    member.size = std::min(member.size + length, capacity());
+}
+
+template <typename T, std::size_t N>
+void circular_array<T, N>::pop_front() noexcept
+{
+    assert(!empty());
+
+    --member.size;
+}
+
+template <typename T, std::size_t N>
+void circular_array<T, N>::pop_back() noexcept
+{
+    assert(!empty());
+
+    member.next = capacity() + index(member.next - 1);
+    --member.size;
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::array_one() noexcept -> std::pair<pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(storage.data() + first, std::min(member.size, capacity() - first));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::array_one() const noexcept -> std::pair<const_pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(storage.data() + first, std::min(member.size, capacity() - first));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::array_two() noexcept -> std::pair<pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(storage.data(), member.size - std::min(member.size, capacity() - first));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::array_two() const noexcept -> std::pair<const_pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(storage.data(), member.size - std::min(member.size, capacity() - first));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::begin() -> iterator
+{
+    return iterator(this, vindex(member.next - member.size));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::begin() const -> const_iterator
+{
+    return const_iterator(this, vindex(member.next - member.size));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::cbegin() const -> const_iterator
+{
+    return const_iterator(this, vindex(member.next - member.size));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::end() -> iterator
+{
+    return iterator(this, vindex(member.next));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::end() const -> const_iterator
+{
+    return const_iterator(this, vindex(member.next));
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::cend() const -> const_iterator
+{
+    return const_iterator(this, vindex(member.next));
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::index(size_type position) const noexcept -> size_type
+{
+    // The mask is a compile-time constant for fixed capacities
+    return (storage.mask() != 0)
+        ? position & storage.mask()
+        : position % capacity();
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::vindex(size_type position) const noexcept -> size_type
+{
+    return (storage.mask() != 0)
+        ? position & (2 * storage.mask() + 1)
+        : position % (2 * capacity());
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::at(size_type position) noexcept -> reference
+{
+    return storage.data()[index(position)];
+}
+
+template <typename T, std::size_t N>
+auto circular_array<T, N>::at(size_type position) const noexcept -> const_reference
+{
+    return storage.data()[index(position)];
+}
+
+//-----------------------------------------------------------------------------
+// circular_array<T, N>::basic_iterator
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+template <typename U>
+circular_array<T, N>::basic_iterator<U>::basic_iterator(parent_pointer parent,
+                                                          size_type position)
+    : parent(parent),
+      current(position)
+{
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator++ () noexcept -> iterator_type&
+{
+    assert(parent);
+
+    current = parent->vindex(current + 1);
+    return *this;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator++ (int) noexcept -> iterator_type
+{
+    auto result = *this;
+    ++*this;
+    return result;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator-> () const noexcept -> pointer
+{
+    assert(parent);
+
+    return std::addressof(parent->at(current));
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator-- () noexcept -> iterator_type&
+{
+    assert(parent);
+
+    current = parent->vindex(current + 2 * parent->capacity() - 1);
+    return *this;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator-- (int) noexcept -> iterator_type
+{
+    auto result = *this;
+    --*this;
+    return result;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator+= (difference_type amount) noexcept -> iterator_type&
+{
+    assert(parent);
+
+    // Iterators stay within one capacity of each other, so adding twice the
+    // capacity keeps the position positive without changing its value.
+    current = parent->vindex(size_type(difference_type(current + 2 * parent->capacity()) + amount));
+    return *this;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator-= (difference_type amount) noexcept -> iterator_type&
+{
+    return operator+=(-amount);
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator+ (difference_type amount) const noexcept -> iterator_type
+{
+    auto result = *this;
+    result += amount;
+    return result;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator- (difference_type amount) const noexcept -> iterator_type
+{
+    auto result = *this;
+    result -= amount;
+    return result;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator- (const iterator_type& other) const noexcept -> difference_type
+{
+    assert(parent == other.parent);
+
+    return offset() - other.offset();
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator[] (difference_type amount) const noexcept -> reference
+{
+    return *(*this + amount);
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::offset() const noexcept -> difference_type
+{
+    assert(parent);
+
+    // Distance from the beginning of the parent
+    const auto first = parent->member.next - parent->member.size;
+    return difference_type(parent->vindex(current + 2 * parent->capacity() - parent->vindex(first)));
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+auto circular_array<T, N>::basic_iterator<U>::operator* () const noexcept -> reference
+{
+    assert(parent);
+
+    return parent->at(current);
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+bool circular_array<T, N>::basic_iterator<U>::operator== (const iterator_type& other) const noexcept
+{
+    assert(parent);
+    assert(parent == other.parent);
+
+    return current == other.current;
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+bool circular_array<T, N>::basic_iterator<U>::operator!= (const iterator_type& other) const noexcept
+{
+    return !operator==(other);
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+bool circular_array<T, N>::basic_iterator<U>::operator< (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() < other.offset();
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+bool circular_array<T, N>::basic_iterator<U>::operator<= (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() <= other.offset();
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+bool circular_array<T, N>::basic_iterator<U>::operator> (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() > other.offset();
+}
+
+template <typename T, std::size_t N>
+template <typename U>
+bool circular_array<T, N>::basic_iterator<U>::operator>= (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() >= other.offset();
+}
+
+} // namespace online
+} // namespace trial
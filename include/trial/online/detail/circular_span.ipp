@@ -9,6 +9,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cassert>
+#include <algorithm>
+#include <memory>
 
 namespace trial
 {
@@ -23,7 +25,11 @@ template <typename T>
 template <typename ContiguousIterator>
 circular_span<T>::circular_span(ContiguousIterator begin,
                                 ContiguousIterator end) noexcept
-    : member{std::addressof(*begin), size_type(std::distance(begin, end)), 0, 0}
+    : member{std::addressof(*begin),
+             size_type(std::distance(begin, end)),
+             detail::circular_mask(std::distance(begin, end)),
+             0,
+             0}
 {
 }
 
@@ -33,7 +39,11 @@ circular_span<T>::circular_span(ContiguousIterator begin,
                                 ContiguousIterator end,
                                 ContiguousIterator first,
                                 size_type length) noexcept
-    : member{std::addressof(*begin), size_type(std::distance(begin, end)), length, size_type(std::distance(begin, first))}
+    : member{std::addressof(*begin),
+             size_type(std::distance(begin, end)),
+             detail::circular_mask(std::distance(begin, end)),
+             length,
+             size_type(std::distance(begin, first))}
 {
 }
 
@@ -75,6 +85,22 @@ auto circular_span<T>::size() const noexcept -> size_type
     return member.size;
 }
 
+template <typename T>
+auto circular_span<T>::operator[] (size_type position) noexcept -> reference
+{
+    assert(position < size());
+
+    return at(member.next - member.size + position);
+}
+
+template <typename T>
+auto circular_span<T>::operator[] (size_type position) const noexcept -> const_reference
+{
+    assert(position < size());
+
+    return at(member.next - member.size + position);
+}
+
 template <typename T>
 auto circular_span<T>::front() const noexcept -> const_reference
 {
@@ -145,6 +171,30 @@ void circular_span<T>::push_back(value_type input) noexcept(std::is_nothrow_move
     }
 }
 
+template <typename T>
+template <typename ForwardIterator>
+void circular_span<T>::push_back(ForwardIterator first, ForwardIterator last) noexcept(std::is_nothrow_copy_assignable<T>::value)
+{
+    auto length = size_type(std::distance(first, last));
+    if (length == 0)
+        return;
+    if (length > member.capacity)
+    {
+        // Skip elements that would be overwritten anyway
+        std::advance(first, length - member.capacity);
+        length = member.capacity;
+    }
+    const auto start = index(member.next);
+    const auto head = std::min(length, member.capacity - start);
+    auto middle = first;
+    std::advance(middle, head);
+    std::copy(first, middle, member.data + start);
+    std::copy(middle, last, member.data);
+
+    member.next = member.capacity + index(member.next + length - 1) + 1;
+    member.size = std::min(member.size + length, member.capacity);
+}
+
 template <typename T>
 void circular_span<T>::pop_front() noexcept
 {
@@ -162,6 +212,34 @@ void circular_span<T>::pop_back() noexcept
     --member.size;
 }
 
+template <typename T>
+auto circular_span<T>::array_one() noexcept -> std::pair<pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(member.data + first, std::min(member.size, member.capacity - first));
+}
+
+template <typename T>
+auto circular_span<T>::array_one() const noexcept -> std::pair<const_pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(member.data + first, std::min(member.size, member.capacity - first));
+}
+
+template <typename T>
+auto circular_span<T>::array_two() noexcept -> std::pair<pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(member.data, member.size - std::min(member.size, member.capacity - first));
+}
+
+template <typename T>
+auto circular_span<T>::array_two() const noexcept -> std::pair<const_pointer, size_type>
+{
+    const auto first = index(member.next - member.size);
+    return std::make_pair(member.data, member.size - std::min(member.size, member.capacity - first));
+}
+
 template <typename T>
 auto circular_span<T>::begin() -> iterator
 {
@@ -203,13 +281,18 @@ auto circular_span<T>::cend() const -> const_iterator
 template <typename T>
 auto circular_span<T>::index(size_type position) const noexcept -> size_type
 {
-    return position % member.capacity;
+    // Power-of-two capacities use a mask instead of the slower modulo
+    return (member.mask != 0)
+        ? position & member.mask
+        : position % member.capacity;
 }
 
 template <typename T>
 auto circular_span<T>::vindex(size_type position) const noexcept -> size_type
 {
-    return position % (2 * member.capacity);
+    return (member.mask != 0)
+        ? position & (2 * member.mask + 1)
+        : position % (2 * member.capacity);
 }
 
 template <typename T>
@@ -247,6 +330,107 @@ auto circular_span<T>::basic_iterator<U>::operator++ () noexcept -> iterator_typ
     return *this;
 }
 
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator++ (int) noexcept -> iterator_type
+{
+    auto result = *this;
+    ++*this;
+    return result;
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator-> () noexcept -> pointer
+{
+    assert(parent);
+
+    return std::addressof(parent->at(current));
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator-- () noexcept -> iterator_type&
+{
+    assert(parent);
+
+    current = parent->vindex(current + 2 * parent->member.capacity - 1);
+    return *this;
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator-- (int) noexcept -> iterator_type
+{
+    auto result = *this;
+    --*this;
+    return result;
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator+= (difference_type amount) noexcept -> iterator_type&
+{
+    assert(parent);
+
+    // Iterators stay within one capacity of each other, so adding twice the
+    // capacity keeps the position positive without changing its value.
+    current = parent->vindex(size_type(difference_type(current + 2 * parent->member.capacity) + amount));
+    return *this;
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator-= (difference_type amount) noexcept -> iterator_type&
+{
+    return operator+=(-amount);
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator+ (difference_type amount) const noexcept -> iterator_type
+{
+    auto result = *this;
+    result += amount;
+    return result;
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator- (difference_type amount) const noexcept -> iterator_type
+{
+    auto result = *this;
+    result -= amount;
+    return result;
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator- (const iterator_type& other) const noexcept -> difference_type
+{
+    assert(parent == other.parent);
+
+    return offset() - other.offset();
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::operator[] (difference_type amount) const noexcept -> const_reference
+{
+    return *(*this + amount);
+}
+
+template <typename T>
+template <typename U>
+auto circular_span<T>::basic_iterator<U>::offset() const noexcept -> difference_type
+{
+    assert(parent);
+
+    // Distance from the beginning of the parent
+    const auto first = parent->member.next - parent->member.size;
+    return difference_type(parent->vindex(current + 2 * parent->member.capacity - parent->vindex(first)));
+}
+
 template <typename T>
 template <typename U>
 auto circular_span<T>::basic_iterator<U>::operator* () const noexcept -> const_reference
@@ -273,5 +457,41 @@ bool circular_span<T>::basic_iterator<U>::operator!= (const iterator_type& other
     return !operator==(other);
 }
 
+template <typename T>
+template <typename U>
+bool circular_span<T>::basic_iterator<U>::operator< (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() < other.offset();
+}
+
+template <typename T>
+template <typename U>
+bool circular_span<T>::basic_iterator<U>::operator<= (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() <= other.offset();
+}
+
+template <typename T>
+template <typename U>
+bool circular_span<T>::basic_iterator<U>::operator> (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() > other.offset();
+}
+
+template <typename T>
+template <typename U>
+bool circular_span<T>::basic_iterator<U>::operator>= (const iterator_type& other) const noexcept
+{
+    assert(parent == other.parent);
+
+    return offset() >= other.offset();
+}
+
 } // namespace online
 } // namespace trial
@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+namespace trial
+{
+namespace online
+{
+
+template <typename T>
+template <typename ContiguousIterator>
+spsc_circular_span<T>::spsc_circular_span(ContiguousIterator begin,
+                                          ContiguousIterator end) noexcept
+    : member{std::addressof(*begin),
+             size_type(std::distance(begin, end)),
+             detail::circular_mask(std::distance(begin, end))}
+{
+    assert(member.capacity > 0);
+
+    consumer.head.store(0, std::memory_order_relaxed);
+    consumer.tail_cache = 0;
+    producer.tail.store(0, std::memory_order_relaxed);
+    producer.head_cache = 0;
+}
+
+template <typename T>
+template <std::size_t N>
+spsc_circular_span<T>::spsc_circular_span(value_type (&array)[N]) noexcept
+    : spsc_circular_span(array, array + N)
+{
+}
+
+template <typename T>
+auto spsc_circular_span<T>::capacity() const noexcept -> size_type
+{
+    return member.capacity;
+}
+
+template <typename T>
+auto spsc_circular_span<T>::size() const noexcept -> size_type
+{
+    // Load head first so that the difference never underflows
+    const auto head = consumer.head.load(std::memory_order_acquire);
+    const auto tail = producer.tail.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+template <typename T>
+bool spsc_circular_span<T>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T>
+bool spsc_circular_span<T>::try_push(const value_type& input) noexcept
+{
+    const auto tail = producer.tail.load(std::memory_order_relaxed);
+    if (tail - producer.head_cache == member.capacity)
+    {
+        producer.head_cache = consumer.head.load(std::memory_order_acquire);
+        if (tail - producer.head_cache == member.capacity)
+            return false;
+    }
+    member.data[index(tail)] = input;
+    producer.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+template <typename ForwardIterator>
+auto spsc_circular_span<T>::try_push(ForwardIterator first, ForwardIterator last) noexcept -> size_type
+{
+    const auto tail = producer.tail.load(std::memory_order_relaxed);
+    const auto wanted = size_type(std::distance(first, last));
+    if (member.capacity - (tail - producer.head_cache) < wanted)
+    {
+        producer.head_cache = consumer.head.load(std::memory_order_acquire);
+    }
+    const auto count = std::min(wanted, member.capacity - (tail - producer.head_cache));
+    if (count == 0)
+        return 0;
+    copy_in(tail, first, count);
+    producer.tail.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+bool spsc_circular_span<T>::try_pop(reference output) noexcept
+{
+    const auto head = consumer.head.load(std::memory_order_relaxed);
+    if (head == consumer.tail_cache)
+    {
+        consumer.tail_cache = producer.tail.load(std::memory_order_acquire);
+        if (head == consumer.tail_cache)
+            return false;
+    }
+    output = member.data[index(head)];
+    consumer.head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+template <typename OutputIterator>
+auto spsc_circular_span<T>::try_pop(OutputIterator output, size_type wanted) noexcept -> size_type
+{
+    const auto head = consumer.head.load(std::memory_order_relaxed);
+    if (consumer.tail_cache - head < wanted)
+    {
+        consumer.tail_cache = producer.tail.load(std::memory_order_acquire);
+    }
+    const auto count = std::min(wanted, consumer.tail_cache - head);
+    if (count == 0)
+        return 0;
+    copy_out(head, output, count);
+    consumer.head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T>
+auto spsc_circular_span<T>::index(size_type position) const noexcept -> size_type
+{
+    return (member.mask != 0)
+        ? position & member.mask
+        : position % member.capacity;
+}
+
+template <typename T>
+template <typename ForwardIterator>
+void spsc_circular_span<T>::copy_in(size_type position,
+                                    ForwardIterator first,
+                                    size_type count) noexcept
+{
+    // Copy in at most two segments
+    const auto start = index(position);
+    const auto head = std::min(count, member.capacity - start);
+    auto middle = first;
+    std::advance(middle, head);
+    std::copy(first, middle, member.data + start);
+    auto last = middle;
+    std::advance(last, count - head);
+    std::copy(middle, last, member.data);
+}
+
+template <typename T>
+template <typename OutputIterator>
+OutputIterator spsc_circular_span<T>::copy_out(size_type position,
+                                               OutputIterator output,
+                                               size_type count) const noexcept
+{
+    // Copy out at most two segments
+    const auto start = index(position);
+    const auto head = std::min(count, member.capacity - start);
+    output = std::copy(member.data + start, member.data + start + head, output);
+    return std::copy(member.data, member.data + (count - head), output);
+}
+
+} // namespace online
+} // namespace trial
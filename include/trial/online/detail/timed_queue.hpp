@@ -0,0 +1,137 @@
+#ifndef TRIAL_ONLINE_DETAIL_TIMED_QUEUE_HPP
+#define TRIAL_ONLINE_DETAIL_TIMED_QUEUE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace trial
+{
+namespace online
+{
+namespace detail
+{
+
+//! @brief Queue stored in a growable ring.
+//!
+//! The capacity is a power of two. It is doubled when the queue is full, and
+//! halved when the queue is less than a quarter full, so there is no
+//! allocation per element.
+
+template <typename T>
+class timed_queue
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type minimum_capacity = 16;
+
+    timed_queue()
+        : storage(minimum_capacity),
+          member{0, 0}
+    {
+    }
+
+    void clear() noexcept
+    {
+        member.head = 0;
+        member.size = 0;
+    }
+
+    bool empty() const noexcept
+    {
+        return member.size == 0;
+    }
+
+    size_type size() const noexcept
+    {
+        return member.size;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return storage.size();
+    }
+
+    //! @pre !empty()
+    const value_type& front() const noexcept
+    {
+        assert(!empty());
+        return storage[member.head];
+    }
+
+    //! @pre !empty()
+    const value_type& back() const noexcept
+    {
+        assert(!empty());
+        return (*this)[member.size - 1];
+    }
+
+    //! @pre position < size()
+    const value_type& operator[] (size_type position) const noexcept
+    {
+        return storage[(member.head + position) & (capacity() - 1)];
+    }
+
+    void push_back(const value_type& input)
+    {
+        if (member.size == capacity())
+        {
+            resize(2 * capacity());
+        }
+        storage[(member.head + member.size) & (capacity() - 1)] = input;
+        ++member.size;
+    }
+
+    //! @pre !empty()
+    void pop_front()
+    {
+        assert(!empty());
+        member.head = (member.head + 1) & (capacity() - 1);
+        --member.size;
+        if ((capacity() > minimum_capacity) && (member.size < capacity() / 4))
+        {
+            resize(capacity() / 2);
+        }
+    }
+
+private:
+    void resize(size_type length)
+    {
+        std::vector<value_type> other(length);
+        for (size_type k = 0; k < member.size; ++k)
+        {
+            other[k] = (*this)[k];
+        }
+        storage.swap(other);
+        member.head = 0;
+    }
+
+private:
+    std::vector<value_type> storage;
+    struct
+    {
+        size_type head;
+        size_type size;
+    } member;
+};
+
+template <typename T>
+constexpr typename timed_queue<T>::size_type timed_queue<T>::minimum_capacity;
+
+} // namespace detail
+} // namespace online
+} // namespace trial
+
+#endif // TRIAL_ONLINE_DETAIL_TIMED_QUEUE_HPP
@@ -0,0 +1,142 @@
+#ifndef TRIAL_ONLINE_SPSC_CIRCULAR_SPAN_HPP
+#define TRIAL_ONLINE_SPSC_CIRCULAR_SPAN_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <atomic>
+#include <type_traits>
+#include <trial/online/circular_span.hpp>
+
+namespace trial
+{
+namespace online
+{
+
+//! @brief Lock-free single-producer single-consumer circular span.
+//!
+//! The span covers externally supplied storage and does not allocate. One
+//! thread may push elements while another thread pops elements.
+//!
+//! Unlike circular_span, pushing onto a full span fails rather than
+//! overwriting the oldest element.
+//!
+//! The producer and consumer positions are kept on separate cache lines
+//! together with a cached copy of the position of the other side, so each
+//! side only reads the shared position of the other side when its cached
+//! copy runs out.
+
+template <typename T>
+class spsc_circular_span
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using pointer = typename std::add_pointer<value_type>::type;
+    using reference = typename std::add_lvalue_reference<value_type>::type;
+
+    static_assert(std::is_nothrow_copy_assignable<T>::value, "T must be nothrow copy assignable");
+
+    //! @brief Creates circular span.
+    //!
+    //! The span covers the range from begin to end.
+    template <typename ContiguousIterator>
+    spsc_circular_span(ContiguousIterator begin,
+                       ContiguousIterator end) noexcept;
+
+    template <std::size_t N>
+    spsc_circular_span(value_type (&array)[N]) noexcept;
+
+    spsc_circular_span(const spsc_circular_span&) = delete;
+    spsc_circular_span& operator= (const spsc_circular_span&) = delete;
+
+    //! @brief Returns the maximum possible number of elements in span.
+    size_type capacity() const noexcept;
+
+    //! @brief Returns the number of elements in span.
+    //!
+    //! The result is only a snapshot if the other thread is active.
+    size_type size() const noexcept;
+
+    //! @brief Checks if span is empty.
+    bool empty() const noexcept;
+
+    //! @brief Inserts element at end of span.
+    //!
+    //! Must only be called by the producer.
+    //!
+    //! @returns false if span is full.
+    bool try_push(const value_type& input) noexcept;
+
+    //! @brief Inserts elements at end of span.
+    //!
+    //! Inserts as many elements from the beginning of the range as there is
+    //! room for. Must only be called by the producer.
+    //!
+    //! @returns Number of inserted elements.
+    template <typename ForwardIterator>
+    size_type try_push(ForwardIterator first, ForwardIterator last) noexcept;
+
+    //! @brief Removes element from beginning of span.
+    //!
+    //! Must only be called by the consumer.
+    //!
+    //! @returns false if span is empty.
+    bool try_pop(reference output) noexcept;
+
+    //! @brief Removes elements from beginning of span.
+    //!
+    //! Removes up to @c count elements and writes them to @c output. Must only
+    //! be called by the consumer.
+    //!
+    //! @returns Number of removed elements.
+    template <typename OutputIterator>
+    size_type try_pop(OutputIterator output, size_type count) noexcept;
+
+private:
+    size_type index(size_type) const noexcept;
+
+    template <typename ForwardIterator>
+    void copy_in(size_type position, ForwardIterator first, size_type count) noexcept;
+    template <typename OutputIterator>
+    OutputIterator copy_out(size_type position, OutputIterator output, size_type count) const noexcept;
+
+private:
+    static constexpr std::size_t cache_line_size = 64;
+
+    struct
+    {
+        const pointer data;
+        const size_type capacity;
+        const size_type mask;
+    } member;
+
+    // Written by consumer
+    struct alignas(cache_line_size)
+    {
+        std::atomic<size_type> head;
+        size_type tail_cache;
+    } consumer;
+
+    // Written by producer
+    struct alignas(cache_line_size)
+    {
+        std::atomic<size_type> tail;
+        size_type head_cache;
+    } producer;
+};
+
+} // namespace online
+} // namespace trial
+
+#include <trial/online/detail/spsc_circular_span.ipp>
+
+#endif // TRIAL_ONLINE_SPSC_CIRCULAR_SPAN_HPP
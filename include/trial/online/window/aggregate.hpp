@@ -0,0 +1,198 @@
+#ifndef TRIAL_ONLINE_WINDOW_AGGREGATE_HPP
+#define TRIAL_ONLINE_WINDOW_AGGREGATE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <trial/online/circular_array.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace monoid
+{
+
+//! @brief Monoid returning the smallest value.
+
+template <typename T>
+struct minimum
+{
+    T identity() const noexcept
+    {
+        return std::numeric_limits<T>::has_infinity
+            ? std::numeric_limits<T>::infinity()
+            : std::numeric_limits<T>::max();
+    }
+
+    T operator() (const T& lhs, const T& rhs) const noexcept
+    {
+        return (rhs < lhs) ? rhs : lhs;
+    }
+};
+
+//! @brief Monoid returning the largest value.
+
+template <typename T>
+struct maximum
+{
+    T identity() const noexcept
+    {
+        return std::numeric_limits<T>::has_infinity
+            ? -std::numeric_limits<T>::infinity()
+            : std::numeric_limits<T>::lowest();
+    }
+
+    T operator() (const T& lhs, const T& rhs) const noexcept
+    {
+        return (lhs < rhs) ? rhs : lhs;
+    }
+};
+
+//! @brief Monoid returning the bitwise or of values.
+
+template <typename T>
+struct bit_or
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral type");
+
+    T identity() const noexcept
+    {
+        return T(0);
+    }
+
+    T operator() (const T& lhs, const T& rhs) const noexcept
+    {
+        return lhs | rhs;
+    }
+};
+
+//! @brief Monoid returning the greatest common divisor of values.
+
+template <typename T>
+struct gcd
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral type");
+
+    T identity() const noexcept
+    {
+        return T(0);
+    }
+
+    T operator() (T lhs, T rhs) const noexcept
+    {
+        if (lhs < 0)
+            lhs = -lhs;
+        if (rhs < 0)
+            rhs = -rhs;
+        while (rhs != 0)
+        {
+            const T remainder = lhs % rhs;
+            lhs = rhs;
+            rhs = remainder;
+        }
+        return lhs;
+    }
+};
+
+//! @brief Monoid merging filters.
+//!
+//! T must be default constructible and support operator+=.
+
+template <typename T>
+struct merge
+{
+    T identity() const noexcept
+    {
+        return T();
+    }
+
+    T operator() (T lhs, const T& rhs) const noexcept
+    {
+        lhs += rhs;
+        return lhs;
+    }
+};
+
+} // namespace monoid
+
+namespace window
+{
+
+//! @brief Aggregate of an associative operation over a sliding window.
+//!
+//! Monoid must provide identity() and an associative binary operator(). The
+//! operator need not be invertible.
+//!
+//! Uses the two-stacks algorithm. The older part of the window holds
+//! aggregates of each element up to the end of the older part, and the newer
+//! part holds a single running aggregate. When the older part runs empty, the
+//! aggregates are recalculated over the entire window. Push is amortized O(1)
+//! and queries are O(1).
+
+template <typename T, std::size_t N, typename Monoid>
+class aggregate
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using monoid_type = Monoid;
+
+    static_assert(N > 0, "N must be larger than zero");
+
+    //! @brief Creates filter with fixed window length.
+    explicit aggregate(const monoid_type& = monoid_type()) noexcept;
+
+    //! @brief Creates filter with dynamic window length.
+    explicit aggregate(size_type capacity,
+                       const monoid_type& = monoid_type());
+
+    void clear() noexcept;
+    void push(const value_type& input) noexcept;
+
+    size_type capacity() const noexcept;
+    bool empty() const noexcept;
+    bool full() const noexcept;
+    size_type size() const noexcept;
+
+    //! @brief Returns aggregate of all values in window.
+    //!
+    //! Returns the identity if window is empty.
+    value_type value() const noexcept;
+
+protected:
+    void flip() noexcept;
+
+protected:
+    struct element_type
+    {
+        value_type value;
+        value_type aggregate;
+    };
+
+    monoid_type monoid;
+    circular_array<element_type, N> window;
+    struct
+    {
+        value_type back;
+        size_type front_size;
+    } member;
+};
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/aggregate.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_AGGREGATE_HPP
@@ -0,0 +1,149 @@
+#ifndef TRIAL_ONLINE_WINDOW_BUCKETED_HPP
+#define TRIAL_ONLINE_WINDOW_BUCKETED_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <chrono>
+#include <trial/online/circular_array.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//! @brief Approximate sliding window of mergeable filters.
+//!
+//! The window is divided into K buckets, each of which is a cumulative
+//! filter over a slice of the window. Inputs are pushed into the newest
+//! bucket, and a rotation starts a new bucket and drops the oldest bucket
+//! once there are K buckets. Queries merge the buckets.
+//!
+//! Memory is O(K) regardless of the number of inputs in the window, but the
+//! oldest bucket is dropped as a whole, so the window covers between K-1
+//! and K slices.
+//!
+//! Filter must be default constructible, and support push() and operator+=,
+//! such as the cumulative moments.
+
+template <typename Filter, std::size_t K>
+class bucketed
+{
+public:
+    using filter_type = Filter;
+    using size_type = std::size_t;
+
+    static_assert(K > 1, "K must be larger than one");
+    static_assert(K != dynamic_extent, "K must be fixed");
+
+    //! @brief Creates bucketed window.
+    //!
+    //! Rotates buckets after every @c bucket_size inputs. If @c bucket_size
+    //! is zero, then buckets are only rotated by calling rotate().
+    explicit bucketed(size_type bucket_size = 0) noexcept;
+
+    void clear() noexcept;
+
+    //! @brief Appends input to newest bucket.
+    template <typename... Args>
+    void push(Args&&... args);
+
+    //! @brief Starts a new bucket.
+    //!
+    //! Drops the oldest bucket if there are K buckets.
+    void rotate() noexcept;
+
+    //! @brief Returns the number of buckets.
+    size_type capacity() const noexcept;
+
+    //! @brief Returns the number of active buckets.
+    size_type size() const noexcept;
+
+    bool empty() const noexcept;
+
+    //! @brief Returns filter merged from all buckets.
+    filter_type value() const;
+
+    //! @brief Returns bucket by position.
+    //!
+    //! Position zero is the oldest bucket.
+    //!
+    //! @pre position < size()
+    const filter_type& operator[] (size_type position) const noexcept;
+
+protected:
+    circular_array<filter_type, K> buckets;
+    struct
+    {
+        size_type bucket_size;
+        size_type count;
+    } member;
+};
+
+//! @brief Approximate sliding time window of mergeable filters.
+//!
+//! Each bucket covers a fixed time slice, so the window covers between K-1
+//! and K slices. Buckets are rotated when inputs or expire() advance the time
+//! past the current slice.
+//!
+//! Timestamps must be non-decreasing.
+
+template <typename Filter, std::size_t K, typename Clock = std::chrono::steady_clock>
+class timed_bucketed
+    : protected bucketed<Filter, K>
+{
+protected:
+    using super = bucketed<Filter, K>;
+
+public:
+    using typename super::filter_type;
+    using typename super::size_type;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    //! @brief Creates bucketed window where each bucket covers @c slice.
+    explicit timed_bucketed(duration slice) noexcept;
+
+    void clear() noexcept;
+
+    //! @brief Appends input to the bucket covering @c now.
+    template <typename... Args>
+    void push(time_point now, Args&&... args);
+
+    //! @brief Rotates buckets until the newest bucket covers @c now.
+    void expire(time_point now) noexcept;
+
+    //! @brief Returns duration of each bucket.
+    duration slice() const noexcept;
+
+    using super::capacity;
+    using super::size;
+    using super::empty;
+    using super::value;
+    using super::operator[];
+
+protected:
+    struct
+    {
+        duration slice;
+        time_point start;
+    } time;
+};
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/bucketed.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_BUCKETED_HPP
@@ -11,7 +11,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <trial/online/circular_span.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <trial/online/circular_array.hpp>
 #include <trial/online/with.hpp>
 
 namespace trial
@@ -21,33 +23,75 @@ namespace online
 namespace window
 {
 
-template <typename T, std::size_t Window, online::with Moment>
+//! @brief Co-moments over a sliding window.
+//!
+//! The window stores the x and y inputs in separate arrays, which share a
+//! single ring index.
+//!
+//! The window stores the inputs as @c Storage, which can be a narrower type
+//! than @c T to reduce the memory footprint, while the sums are kept as @c T.
+//!
+//! The sums are recalculated exactly from the window every time the window
+//! has been entirely replaced.
+
+template <typename T, std::size_t Window, online::with Moment, typename Storage = T>
 class basic_comoment;
 
-template <typename T, std::size_t Window>
-class basic_comoment<T, Window, with::variance>
+template <typename T, std::size_t Window, typename Storage>
+class basic_comoment<T, Window, with::variance, Storage>
 {
 public:
     using value_type = T;
+    using storage_type = Storage;
     using size_type = std::size_t;
-    
+
     static_assert(std::is_floating_point<T>::value, "T must be an floating-point type");
+    static_assert(std::is_arithmetic<Storage>::value, "Storage must be an arithmetic type");
 
+    //! @brief Creates filter with fixed window length.
     basic_comoment() noexcept;
 
+    //! @brief Creates filter with dynamic window length.
+    //!
+    //! The window is allocated on the heap.
+    explicit basic_comoment(size_type capacity);
+
+    //! @brief Creates filter with dynamic window length.
+    //!
+    //! The window is stored in the range of storage_type from @c begin to
+    //! @c end. The first half of the range stores x and the second half
+    //! stores y, so the capacity is half the length of the range. The range
+    //! must outlive the filter.
+    template <typename ContiguousIterator>
+    basic_comoment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
     void clear() noexcept;
     void push(value_type first, value_type second) noexcept;
 
+    size_type capacity() const noexcept;
     size_type size() const noexcept;
     value_type variance() const noexcept;
     value_type unbiased_variance() const noexcept;
 
 protected:
     value_type cosum() const noexcept;
+    bool full() const noexcept;
+    //! @brief Returns index of oldest input in storage.
+    size_type front() const noexcept;
+    //! @brief Returns index of newest input in storage.
+    size_type back() const noexcept;
+    bool aligned() const noexcept;
+    void resync() noexcept;
 
 protected:
-    std::pair<value_type, value_type> storage[Window];
-    circular_span<std::pair<value_type, value_type>> window;
+    online::detail::circular_array_storage<storage_type, Window> x_storage;
+    online::detail::circular_array_storage<storage_type, Window> y_storage;
+    struct
+    {
+        size_type size = 0;
+        // Index where next input is stored
+        size_type next = 0;
+    } member;
     struct
     {
         value_type x = value_type(0);
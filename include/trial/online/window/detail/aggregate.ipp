@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+template <typename T, std::size_t N, typename Monoid>
+aggregate<T, N, Monoid>::aggregate(const monoid_type& m) noexcept
+    : monoid(m),
+      member{monoid.identity(), 0}
+{
+    static_assert(N != dynamic_extent, "Dynamic window length must be passed to constructor");
+}
+
+template <typename T, std::size_t N, typename Monoid>
+aggregate<T, N, Monoid>::aggregate(size_type capacity,
+                                   const monoid_type& m)
+    : monoid(m),
+      window(capacity),
+      member{monoid.identity(), 0}
+{
+    static_assert(N == dynamic_extent, "Window length is fixed by template parameter");
+}
+
+template <typename T, std::size_t N, typename Monoid>
+void aggregate<T, N, Monoid>::clear() noexcept
+{
+    window.clear();
+    member.back = monoid.identity();
+    member.front_size = 0;
+}
+
+template <typename T, std::size_t N, typename Monoid>
+auto aggregate<T, N, Monoid>::capacity() const noexcept -> size_type
+{
+    return window.capacity();
+}
+
+template <typename T, std::size_t N, typename Monoid>
+bool aggregate<T, N, Monoid>::empty() const noexcept
+{
+    return window.empty();
+}
+
+template <typename T, std::size_t N, typename Monoid>
+bool aggregate<T, N, Monoid>::full() const noexcept
+{
+    return window.full();
+}
+
+template <typename T, std::size_t N, typename Monoid>
+auto aggregate<T, N, Monoid>::size() const noexcept -> size_type
+{
+    return window.size();
+}
+
+template <typename T, std::size_t N, typename Monoid>
+void aggregate<T, N, Monoid>::push(const value_type& input) noexcept
+{
+    if (window.full())
+    {
+        // The oldest element is about to be overwritten
+        if (member.front_size == 0)
+        {
+            flip();
+        }
+        --member.front_size;
+    }
+    window.push_back({ input, input });
+    member.back = monoid(member.back, input);
+}
+
+template <typename T, std::size_t N, typename Monoid>
+auto aggregate<T, N, Monoid>::value() const noexcept -> value_type
+{
+    if (member.front_size == 0)
+        return member.back;
+    return monoid(window.front().aggregate, member.back);
+}
+
+template <typename T, std::size_t N, typename Monoid>
+void aggregate<T, N, Monoid>::flip() noexcept
+{
+    // Move all elements to the older part
+    auto current = monoid.identity();
+    for (size_type k = window.size(); k > 0; --k)
+    {
+        auto& element = window[k - 1];
+        current = monoid(element.value, current);
+        element.aggregate = current;
+    }
+    member.front_size = window.size();
+    member.back = monoid.identity();
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
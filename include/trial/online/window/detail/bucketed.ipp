@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <utility>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//-----------------------------------------------------------------------------
+// bucketed
+//-----------------------------------------------------------------------------
+
+template <typename F, std::size_t K>
+bucketed<F, K>::bucketed(size_type bucket_size) noexcept
+    : member{bucket_size, 0}
+{
+}
+
+template <typename F, std::size_t K>
+void bucketed<F, K>::clear() noexcept
+{
+    buckets.clear();
+    member.count = 0;
+}
+
+template <typename F, std::size_t K>
+template <typename... Args>
+void bucketed<F, K>::push(Args&&... args)
+{
+    if (buckets.empty() || (member.count == member.bucket_size && member.bucket_size > 0))
+    {
+        rotate();
+    }
+    buckets[buckets.size() - 1].push(std::forward<Args>(args)...);
+    ++member.count;
+}
+
+template <typename F, std::size_t K>
+void bucketed<F, K>::rotate() noexcept
+{
+    buckets.push_back(filter_type());
+    member.count = 0;
+}
+
+template <typename F, std::size_t K>
+auto bucketed<F, K>::capacity() const noexcept -> size_type
+{
+    return buckets.capacity();
+}
+
+template <typename F, std::size_t K>
+auto bucketed<F, K>::size() const noexcept -> size_type
+{
+    return buckets.size();
+}
+
+template <typename F, std::size_t K>
+bool bucketed<F, K>::empty() const noexcept
+{
+    return buckets.empty();
+}
+
+template <typename F, std::size_t K>
+auto bucketed<F, K>::value() const -> filter_type
+{
+    filter_type result;
+    for (const auto& bucket : buckets)
+    {
+        result += bucket;
+    }
+    return result;
+}
+
+template <typename F, std::size_t K>
+auto bucketed<F, K>::operator[] (size_type position) const noexcept -> const filter_type&
+{
+    assert(position < size());
+
+    return buckets[position];
+}
+
+//-----------------------------------------------------------------------------
+// timed_bucketed
+//-----------------------------------------------------------------------------
+
+template <typename F, std::size_t K, typename C>
+timed_bucketed<F, K, C>::timed_bucketed(duration slice) noexcept
+    : super(0),
+      time{slice, time_point()}
+{
+    assert(slice > duration::zero());
+}
+
+template <typename F, std::size_t K, typename C>
+void timed_bucketed<F, K, C>::clear() noexcept
+{
+    super::clear();
+}
+
+template <typename F, std::size_t K, typename C>
+template <typename... Args>
+void timed_bucketed<F, K, C>::push(time_point now, Args&&... args)
+{
+    if (super::empty())
+    {
+        time.start = now;
+        super::rotate();
+    }
+    else
+    {
+        expire(now);
+    }
+    super::push(std::forward<Args>(args)...);
+}
+
+template <typename F, std::size_t K, typename C>
+void timed_bucketed<F, K, C>::expire(time_point now) noexcept
+{
+    if (super::empty())
+        return;
+
+    assert(!(now < time.start));
+
+    const auto slices = (now - time.start) / time.slice;
+    if (slices >= decltype(slices)(super::capacity()))
+    {
+        // All buckets have expired
+        super::clear();
+        super::rotate();
+    }
+    else
+    {
+        for (auto k = slices; k > 0; --k)
+        {
+            super::rotate();
+        }
+    }
+    time.start += slices * time.slice;
+}
+
+template <typename F, std::size_t K, typename C>
+auto timed_bucketed<F, K, C>::slice() const noexcept -> duration
+{
+    return time.slice;
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
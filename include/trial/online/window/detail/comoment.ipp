@@ -8,6 +8,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cassert>
+#include <iterator>
+
 namespace trial
 {
 namespace online
@@ -15,32 +18,67 @@ namespace online
 namespace window
 {
 
-template <typename T, std::size_t W>
-basic_comoment<T, W, with::variance>::basic_comoment() noexcept
-    : window(storage)
+template <typename T, std::size_t W, typename S>
+basic_comoment<T, W, with::variance, S>::basic_comoment() noexcept
+{
+    static_assert(W != dynamic_extent, "Dynamic window length must be passed to constructor");
+}
+
+template <typename T, std::size_t W, typename S>
+basic_comoment<T, W, with::variance, S>::basic_comoment(size_type capacity)
+    : x_storage(capacity),
+      y_storage(capacity)
+{
+    static_assert(W == dynamic_extent, "Window length is fixed by template parameter");
+}
+
+template <typename T, std::size_t W, typename S>
+template <typename ContiguousIterator>
+basic_comoment<T, W, with::variance, S>::basic_comoment(ContiguousIterator begin,
+                                                     ContiguousIterator end) noexcept
+    : x_storage(begin, std::next(begin, std::distance(begin, end) / 2)),
+      y_storage(std::next(begin, std::distance(begin, end) / 2), end)
+{
+    static_assert(W == dynamic_extent, "Window length is fixed by template parameter");
+
+    // Odd lengths would leave an element unused
+    assert(std::distance(begin, end) % 2 == 0);
+}
+
+template <typename T, std::size_t W, typename S>
+auto basic_comoment<T, W, with::variance, S>::capacity() const noexcept -> size_type
 {
+    assert(W == dynamic_extent || x_storage.capacity() == W);
+
+    return x_storage.capacity();
 }
 
-template <typename T, std::size_t W>
-auto basic_comoment<T, W, with::variance>::size() const noexcept -> size_type
+template <typename T, std::size_t W, typename S>
+auto basic_comoment<T, W, with::variance, S>::size() const noexcept -> size_type
 {
-    return window.size();
+    return member.size;
 }
 
-template <typename T, std::size_t W>
-void basic_comoment<T, W, with::variance>::clear() noexcept
+template <typename T, std::size_t W, typename S>
+void basic_comoment<T, W, with::variance, S>::clear() noexcept
 {
-    window.clear();
+    member.size = 0;
+    member.next = 0;
     sum.x = sum.y = sum.xy = value_type(0);
 }
 
-template <typename T, std::size_t W>
-void basic_comoment<T, W, with::variance>::push(value_type x, value_type y) noexcept
+template <typename T, std::size_t W, typename S>
+void basic_comoment<T, W, with::variance, S>::push(value_type first, value_type second) noexcept
 {
-    if (window.full())
+    // Use the stored precision so that the sums remain consistent with the window
+    const auto x = value_type(storage_type(first));
+    const auto y = value_type(storage_type(second));
+    const auto index = member.next;
+    if (full())
     {
-        const auto front_x = window.front().first;
-        const auto front_y = window.front().second;
+        // The oldest input is overwritten
+        const auto front_x = value_type(x_storage.data()[index]);
+        const auto front_y = value_type(y_storage.data()[index]);
         sum.x += x - front_x;
         sum.y += y - front_y;
         sum.xy += x * y - front_x * front_y;
@@ -50,26 +88,78 @@ void basic_comoment<T, W, with::variance>::push(value_type x, value_type y) noex
         sum.x += x;
         sum.y += y;
         sum.xy += x * y;
+        ++member.size;
+    }
+    x_storage.data()[index] = storage_type(x);
+    y_storage.data()[index] = storage_type(y);
+    member.next = (index + 1 == capacity()) ? 0 : index + 1;
+    if (aligned())
+    {
+        resync();
+    }
+}
+
+template <typename T, std::size_t W, typename S>
+bool basic_comoment<T, W, with::variance, S>::full() const noexcept
+{
+    return member.size == capacity();
+}
+
+template <typename T, std::size_t W, typename S>
+auto basic_comoment<T, W, with::variance, S>::front() const noexcept -> size_type
+{
+    // Inputs are stored from index zero until the window is full
+    return full() ? member.next : 0;
+}
+
+template <typename T, std::size_t W, typename S>
+auto basic_comoment<T, W, with::variance, S>::back() const noexcept -> size_type
+{
+    assert(member.size > 0);
+
+    return ((member.next == 0) ? capacity() : member.next) - 1;
+}
+
+template <typename T, std::size_t W, typename S>
+bool basic_comoment<T, W, with::variance, S>::aligned() const noexcept
+{
+    // The window is entirely replaced every capacity() pushes
+    return (member.next == 0) && full();
+}
+
+template <typename T, std::size_t W, typename S>
+void basic_comoment<T, W, with::variance, S>::resync() noexcept
+{
+    // The inputs are stored in order from index zero when aligned
+    const auto xs = x_storage.data();
+    const auto ys = y_storage.data();
+    sum.x = sum.y = sum.xy = value_type(0);
+    for (size_type k = 0; k < member.size; ++k)
+    {
+        const auto x = value_type(xs[k]);
+        const auto y = value_type(ys[k]);
+        sum.x += x;
+        sum.y += y;
+        sum.xy += x * y;
     }
-    window.push_back(std::make_pair(x, y));
 }
 
-template <typename T, std::size_t W>
-auto basic_comoment<T, W, with::variance>::cosum() const noexcept -> value_type
+template <typename T, std::size_t W, typename S>
+auto basic_comoment<T, W, with::variance, S>::cosum() const noexcept -> value_type
 {
     return sum.xy - sum.x * sum.y / size();
 }
 
-template <typename T, std::size_t W>
-auto basic_comoment<T, W, with::variance>::variance() const noexcept -> value_type
+template <typename T, std::size_t W, typename S>
+auto basic_comoment<T, W, with::variance, S>::variance() const noexcept -> value_type
 {
     if (size() > 0)
         return cosum() / size();
     return value_type(0);
 }
 
-template <typename T, std::size_t W>
-auto basic_comoment<T, W, with::variance>::unbiased_variance() const noexcept -> value_type
+template <typename T, std::size_t W, typename S>
+auto basic_comoment<T, W, with::variance, S>::unbiased_variance() const noexcept -> value_type
 {
     if (size() > 1)
         return cosum() / (size() - 1);
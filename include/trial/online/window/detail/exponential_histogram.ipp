@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+template <typename T>
+exponential_histogram<T>::exponential_histogram(size_type window, double epsilon)
+    : member{window, size_type(std::ceil(1.0 / epsilon)) + 1, 0, 0}
+{
+    assert(window > 0);
+    assert(epsilon > 0.0);
+
+    promoted.reserve(member.limit);
+}
+
+template <typename T>
+void exponential_histogram<T>::clear() noexcept
+{
+    for (auto& level : levels)
+    {
+        level.clear();
+    }
+    member.time = 0;
+    member.total = 0;
+}
+
+template <typename T>
+void exponential_histogram<T>::push(value_type input)
+{
+    ++member.time;
+    expire();
+    insert(input);
+    member.total += input;
+}
+
+template <typename T>
+auto exponential_histogram<T>::capacity() const noexcept -> size_type
+{
+    return member.window;
+}
+
+template <typename T>
+auto exponential_histogram<T>::size() const noexcept -> size_type
+{
+    return size_type(std::min<timestamp_type>(member.time, member.window));
+}
+
+template <typename T>
+bool exponential_histogram<T>::empty() const noexcept
+{
+    return member.time == 0;
+}
+
+template <typename T>
+auto exponential_histogram<T>::sum() const noexcept -> value_type
+{
+    // Count half of the oldest bucket, which may be partially expired
+    return member.total - error();
+}
+
+template <typename T>
+auto exponential_histogram<T>::error() const noexcept -> value_type
+{
+    // Nothing has expired yet
+    if (member.time <= member.window)
+        return 0;
+    for (auto level = levels.size(); level > 0; --level)
+    {
+        if (!levels[level - 1].empty())
+            return (value_type(1) << (level - 1)) / 2;
+    }
+    return 0;
+}
+
+template <typename T>
+auto exponential_histogram<T>::buckets() const noexcept -> size_type
+{
+    size_type result = 0;
+    for (const auto& level : levels)
+    {
+        result += level.size();
+    }
+    return result;
+}
+
+template <typename T>
+void exponential_histogram<T>::expire() noexcept
+{
+    // Remove buckets whose newest input has left the window
+    for (size_type level = 0; level < levels.size(); ++level)
+    {
+        auto& timestamps = levels[level];
+        auto last = timestamps.begin();
+        while (last != timestamps.end() && member.time - *last >= member.window)
+        {
+            member.total -= value_type(1) << level;
+            ++last;
+        }
+        timestamps.erase(timestamps.begin(), last);
+    }
+}
+
+template <typename T>
+void exponential_histogram<T>::insert(value_type input)
+{
+    // Equivalent to inserting input buckets of size one, one at a time, but
+    // the merges on each level are done in bulk. Buckets on a level are older
+    // than buckets on the levels below, so merged buckets are appended to the
+    // next level, followed by the carried buckets with the current timestamp.
+    promoted.clear();
+    value_type carry = input;
+    for (size_type level = 0; (carry != 0) || !promoted.empty(); ++level)
+    {
+        if (level == levels.size())
+        {
+            levels.emplace_back();
+            levels.back().reserve(member.limit + 1);
+        }
+        auto& timestamps = levels[level];
+        timestamps.insert(timestamps.end(), promoted.begin(), promoted.end());
+        promoted.clear();
+
+        const auto old_count = timestamps.size();
+        if ((old_count <= member.limit) && (carry <= member.limit - old_count))
+        {
+            timestamps.insert(timestamps.end(), size_type(carry), member.time);
+            break;
+        }
+
+        // Merge the oldest pairs until the level is within its limit. A
+        // merged bucket gets the newest timestamp of the pair.
+        const value_type excess = (old_count >= member.limit)
+            ? carry + (old_count - member.limit)
+            : carry - (member.limit - old_count);
+        const value_type merges = excess / 2 + excess % 2;
+        const auto old_merges = size_type(std::min<value_type>(merges, old_count / 2));
+        for (size_type index = 0; index < old_merges; ++index)
+        {
+            promoted.push_back(timestamps[2 * index + 1]);
+        }
+        const auto old_merged = size_type(std::min<value_type>(2 * merges, old_count));
+        timestamps.erase(timestamps.begin(), timestamps.begin() + old_merged);
+        timestamps.insert(timestamps.end(),
+                          size_type(carry - (2 * merges - old_merged)),
+                          member.time);
+        carry = merges - old_merges;
+    }
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+template <typename T, std::size_t N>
+basic_extreme<T, N>::basic_extreme(size_type capacity)
+    : minima(capacity),
+      maxima(capacity)
+{
+    static_assert(N == dynamic_extent, "Window length is fixed by template parameter");
+}
+
+template <typename T, std::size_t N>
+void basic_extreme<T, N>::clear() noexcept
+{
+    minima.clear();
+    maxima.clear();
+    member.count = 0;
+}
+
+template <typename T, std::size_t N>
+auto basic_extreme<T, N>::capacity() const noexcept -> size_type
+{
+    return minima.capacity();
+}
+
+template <typename T, std::size_t N>
+bool basic_extreme<T, N>::empty() const noexcept
+{
+    return member.count == 0;
+}
+
+template <typename T, std::size_t N>
+bool basic_extreme<T, N>::full() const noexcept
+{
+    return member.count >= capacity();
+}
+
+template <typename T, std::size_t N>
+auto basic_extreme<T, N>::size() const noexcept -> size_type
+{
+    return std::min(member.count, capacity());
+}
+
+template <typename T, std::size_t N>
+void basic_extreme<T, N>::push(value_type input) noexcept
+{
+    const auto sequence = member.count++;
+
+    // Expire the candidate that slides out of the window. This must be done
+    // before insertion to keep the number of candidates within capacity.
+    if (!minima.empty() && minima.front().sequence + capacity() <= sequence)
+    {
+        minima.pop_front();
+    }
+    if (!maxima.empty() && maxima.front().sequence + capacity() <= sequence)
+    {
+        maxima.pop_front();
+    }
+
+    // Discard candidates dominated by input
+    while (!minima.empty() && input < minima.back().value)
+    {
+        minima.pop_back();
+    }
+    minima.push_back(element_type{sequence, input});
+
+    while (!maxima.empty() && maxima.back().value < input)
+    {
+        maxima.pop_back();
+    }
+    maxima.push_back(element_type{sequence, input});
+}
+
+template <typename T, std::size_t N>
+auto basic_extreme<T, N>::min() const noexcept -> value_type
+{
+    assert(!empty());
+
+    return minima.front().value;
+}
+
+template <typename T, std::size_t N>
+auto basic_extreme<T, N>::max() const noexcept -> value_type
+{
+    assert(!empty());
+
+    return maxima.front().value;
+}
+
+template <typename T, std::size_t N>
+auto basic_extreme<T, N>::argmin() const noexcept -> size_type
+{
+    assert(!empty());
+
+    return position(minima.front().sequence);
+}
+
+template <typename T, std::size_t N>
+auto basic_extreme<T, N>::argmax() const noexcept -> size_type
+{
+    assert(!empty());
+
+    return position(maxima.front().sequence);
+}
+
+template <typename T, std::size_t N>
+auto basic_extreme<T, N>::position(size_type sequence) const noexcept -> size_type
+{
+    return sequence - (member.count - size());
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
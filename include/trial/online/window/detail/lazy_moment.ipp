@@ -0,0 +1,265 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+//-----------------------------------------------------------------------------
+// Average without variance
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::mean, S>::basic_lazy_moment() noexcept
+{
+    static_assert(N != dynamic_extent, "Dynamic window length must be passed to constructor");
+}
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::mean, S>::basic_lazy_moment(size_type capacity)
+    : window(capacity)
+{
+    static_assert(N == dynamic_extent, "Window length is fixed by template parameter");
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_lazy_moment<T, N, with::mean, S>::basic_lazy_moment(ContiguousIterator begin,
+                                                          ContiguousIterator end) noexcept
+    : window(begin, end)
+{
+    static_assert(N == dynamic_extent, "Window length is fixed by template parameter");
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_lazy_moment<T, N, with::mean, S>::clear() noexcept
+{
+    window.clear();
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_lazy_moment<T, N, with::mean, S>::push(value_type input) noexcept
+{
+    window.push_back(storage_type(input));
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::mean, S>::capacity() const noexcept -> size_type
+{
+    assert(N == dynamic_extent || window.capacity() == N);
+
+    return window.capacity();
+}
+
+template <typename T, std::size_t N, typename S>
+bool basic_lazy_moment<T, N, with::mean, S>::empty() const noexcept
+{
+    return window.empty();
+}
+
+template <typename T, std::size_t N, typename S>
+bool basic_lazy_moment<T, N, with::mean, S>::full() const noexcept
+{
+    return window.full();
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::mean, S>::size() const noexcept -> size_type
+{
+    return window.size();
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::mean, S>::mean() const noexcept -> value_type
+{
+    if (empty())
+        return value_type();
+    const auto sum = central_sum<1>(sum_type(0));
+    return value_type(sum / sum_type(size()));
+}
+
+template <typename T, std::size_t N, typename S>
+template <std::size_t Power, typename R>
+R basic_lazy_moment<T, N, with::mean, S>::central_sum(R center) const noexcept
+{
+    const auto one = window.array_one();
+    const auto two = window.array_two();
+    return detail::central_sum<Power>(one.first, one.second, center)
+        + detail::central_sum<Power>(two.first, two.second, center);
+}
+
+//-----------------------------------------------------------------------------
+// Average with variance
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::variance, S>::basic_lazy_moment() noexcept
+    : super()
+{
+}
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::variance, S>::basic_lazy_moment(size_type capacity)
+    : super(capacity)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_lazy_moment<T, N, with::variance, S>::basic_lazy_moment(ContiguousIterator begin,
+                                                              ContiguousIterator end) noexcept
+    : super(begin, end)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::variance, S>::variance() const noexcept -> result_type
+{
+    const auto count = super::size();
+    return (count > 0)
+        ? normalize(count)
+        : result_type(0);
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::variance, S>::unbiased_variance() const noexcept -> result_type
+{
+    // With Bessel's correction
+    const auto count = super::size();
+    return (count > 1)
+        ? normalize(count - 1)
+        : result_type(0);
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::variance, S>::normalize(size_type divisor) const noexcept -> result_type
+{
+    if (std::is_integral<value_type>::value)
+    {
+        // (n * sum(x^2) - sum(x)^2) / n is exact before the division
+        const auto count = square_type(super::size());
+        const auto linear = square_type(super::template central_sum<1>(typename super::sum_type(0)));
+        const auto numerator = count * super::template central_sum<2>(square_type(0)) - linear * linear;
+        return result_type(numerator) / (result_type(count) * result_type(divisor));
+    }
+    return result_type(super::template central_sum<2>(super::mean())) / result_type(divisor);
+}
+
+//-----------------------------------------------------------------------------
+// With skewness
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::skewness, S>::basic_lazy_moment() noexcept
+    : super()
+{
+}
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::skewness, S>::basic_lazy_moment(size_type capacity)
+    : super(capacity)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_lazy_moment<T, N, with::skewness, S>::basic_lazy_moment(ContiguousIterator begin,
+                                                              ContiguousIterator end) noexcept
+    : super(begin, end)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::skewness, S>::skewness() const noexcept -> value_type
+{
+    if (super::empty())
+        return value_type(0);
+    const auto mean = super::mean();
+    const auto variance = super::template central_sum<2>(mean);
+    const auto skewness = super::template central_sum<3>(mean);
+    if (std::abs(skewness) < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    if (variance < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    return std::sqrt(value_type(super::size())) * skewness / (std::sqrt(variance) * variance);
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::skewness, S>::unbiased_skewness() const noexcept -> value_type
+{
+    const auto count = value_type(super::size());
+    if (count < 3)
+        return value_type(0);
+    // Bias-correction from Octave manual
+    return skewness() * std::sqrt(count * (count - 1)) / (count - 2);
+}
+
+//-----------------------------------------------------------------------------
+// With kurtosis
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::kurtosis, S>::basic_lazy_moment() noexcept
+    : super()
+{
+}
+
+template <typename T, std::size_t N, typename S>
+basic_lazy_moment<T, N, with::kurtosis, S>::basic_lazy_moment(size_type capacity)
+    : super(capacity)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_lazy_moment<T, N, with::kurtosis, S>::basic_lazy_moment(ContiguousIterator begin,
+                                                              ContiguousIterator end) noexcept
+    : super(begin, end)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::kurtosis, S>::kurtosis() const noexcept -> value_type
+{
+    if (super::empty())
+        return value_type(0);
+    const auto mean = super::mean();
+    const auto variance = super::template central_sum<2>(mean);
+    const auto kurtosis = super::template central_sum<4>(mean);
+    if (kurtosis < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    if (variance < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    return value_type(super::size()) * kurtosis / (variance * variance);
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_lazy_moment<T, N, with::kurtosis, S>::unbiased_kurtosis() const noexcept -> value_type
+{
+    const auto count = value_type(super::size());
+    if (count < 4)
+        return value_type(0);
+    // Each kurtosis() call makes three passes over the window
+    const auto biased = kurtosis();
+    if (biased == value_type(0))
+        return value_type(0);
+    // Bias-correction from Octave manual
+    return value_type(3) + (count - 1) / ((count - 2) * (count - 3)) * ((count + 1) * biased - value_type(3) * (count - 1));
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
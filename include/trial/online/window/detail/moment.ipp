@@ -10,6 +10,8 @@
 
 #include <cassert>
 #include <cmath>
+#include <limits>
+#include <algorithm>
 
 namespace trial
 {
@@ -18,133 +20,514 @@ namespace online
 namespace window
 {
 
+namespace detail
+{
+
+template <std::size_t Power>
+struct power
+{
+    template <typename R>
+    static R apply(R value) noexcept
+    {
+        return value * power<Power - 1>::apply(value);
+    }
+};
+
+template <>
+struct power<1>
+{
+    template <typename R>
+    static R apply(R value) noexcept
+    {
+        return value;
+    }
+};
+
+// Sum of powers of deviations from center.
+//
+// Uses independent accumulators so that the additions can be vectorized.
+
+template <std::size_t Power, typename R, typename S>
+R central_sum(const S* data, std::size_t count, R center) noexcept
+{
+    R partial[4] = { R(0), R(0), R(0), R(0) };
+    std::size_t k = 0;
+    for (; k + 4 <= count; k += 4)
+    {
+        partial[0] += power<Power>::apply(R(data[k]) - center);
+        partial[1] += power<Power>::apply(R(data[k + 1]) - center);
+        partial[2] += power<Power>::apply(R(data[k + 2]) - center);
+        partial[3] += power<Power>::apply(R(data[k + 3]) - center);
+    }
+    for (; k < count; ++k)
+    {
+        partial[0] += power<Power>::apply(R(data[k]) - center);
+    }
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+}
+
+} // namespace detail
+
 //-----------------------------------------------------------------------------
 // Average without variance
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t N>
-basic_moment<T, N, with::mean>::basic_moment() noexcept
-    : window(storage)
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::mean, S>::basic_moment() noexcept
+    : member{N}
+{
+    static_assert(N != dynamic_extent, "Dynamic window length must be passed to constructor");
+}
+
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::mean, S>::basic_moment(size_type capacity)
+    : window(capacity),
+      member{capacity}
+{
+    static_assert(N == dynamic_extent, "Window length is fixed by template parameter");
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_moment<T, N, with::mean, S>::basic_moment(ContiguousIterator begin,
+                                             ContiguousIterator end) noexcept
+    : window(begin, end),
+      member{window.capacity()}
 {
+    static_assert(N == dynamic_extent, "Window length is fixed by template parameter");
 }
 
-template <typename T, std::size_t N>
-auto basic_moment<T, N, with::mean>::capacity() const noexcept -> size_type
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::mean, S>::capacity() const noexcept -> size_type
 {
-    assert(window.capacity() == N);
+    assert(N == dynamic_extent || window.capacity() == N);
 
     return window.capacity();
 }
 
-template <typename T, std::size_t N>
-void basic_moment<T, N, with::mean>::clear() noexcept
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::mean, S>::clear() noexcept
 {
-    sum.mean = value_type(0);
+    sum.mean = sum_type(0);
     window.clear();
+    member.countdown = window.capacity();
 }
 
-template <typename T, std::size_t N>
-bool basic_moment<T, N, with::mean>::empty() const noexcept
+template <typename T, std::size_t N, typename S>
+bool basic_moment<T, N, with::mean, S>::empty() const noexcept
 {
     return window.empty();
 }
 
-template <typename T, std::size_t N>
-auto basic_moment<T, N, with::mean>::size() const noexcept -> size_type
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::mean, S>::size() const noexcept -> size_type
 {
     return window.size();
 }
 
-template <typename T, std::size_t N>
-bool basic_moment<T, N, with::mean>::full() const noexcept
+template <typename T, std::size_t N, typename S>
+bool basic_moment<T, N, with::mean, S>::full() const noexcept
 {
     return window.full();
 }
 
-template <typename T, std::size_t N>
-auto basic_moment<T, N, with::mean>::mean() const noexcept -> value_type
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::mean, S>::mean() const noexcept -> value_type
 {
     if (empty())
         return value_type();
-    return sum.mean / value_type(size());
+    return value_type(sum.mean / sum_type(size()));
 }
 
-template <typename T, std::size_t N>
-void basic_moment<T, N, with::mean>::push(value_type value) noexcept
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::mean, S>::push(value_type input) noexcept
 {
+    const auto value = quantize(input);
     if (full())
     {
-        sum.mean += value - window.front();
+        sum.mean += sum_type(value) - sum_type(window.front());
     }
     else
     {
-        sum.mean += value;
+        sum.mean += sum_type(value);
+    }
+    window.push_back(storage_type(value));
+    if (std::is_floating_point<value_type>::value && advance())
+    {
+        resync();
     }
-    window.push_back(value);
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::mean, S>::quantize(value_type input) noexcept -> value_type
+{
+    return value_type(storage_type(input));
+}
+
+template <typename T, std::size_t N, typename S>
+bool basic_moment<T, N, with::mean, S>::advance() noexcept
+{
+    // The window is entirely replaced every capacity() pushes
+    if (--member.countdown > 0)
+        return false;
+    member.countdown = window.capacity();
+    return true;
+}
+
+template <typename T, std::size_t N, typename S>
+bool basic_moment<T, N, with::mean, S>::aligned() const noexcept
+{
+    // Whether the latest push was counted down by advance()
+    return member.countdown == window.capacity();
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::mean, S>::resync() noexcept
+{
+    sum.mean = central_sum<1>(sum_type(0));
+}
+
+template <typename T, std::size_t N, typename S>
+template <std::size_t Power, typename R>
+R basic_moment<T, N, with::mean, S>::central_sum(R center) const noexcept
+{
+    const auto one = window.array_one();
+    const auto two = window.array_two();
+    return detail::central_sum<Power>(one.first, one.second, center)
+        + detail::central_sum<Power>(two.first, two.second, center);
 }
 
 //-----------------------------------------------------------------------------
 // Average with variance
 //-----------------------------------------------------------------------------
 
-template <typename T, std::size_t N>
-basic_moment<T, N, with::variance>::basic_moment() noexcept
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::variance, S>::basic_moment() noexcept
     : super()
 {
 }
 
-template <typename T, std::size_t N>
-void basic_moment<T, N, with::variance>::clear() noexcept
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::variance, S>::basic_moment(size_type capacity)
+    : super(capacity)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_moment<T, N, with::variance, S>::basic_moment(ContiguousIterator begin,
+                                                 ContiguousIterator end) noexcept
+    : super(begin, end)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::variance, S>::clear() noexcept
 {
     super::clear();
-    sum.variance = value_type(0);
+    sum.variance = square_type(0);
 }
 
-template <typename T, std::size_t N>
-void basic_moment<T, N, with::variance>::push(value_type input) noexcept
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::variance, S>::push(value_type input) noexcept
+{
+    push(super::quantize(input), std::is_integral<value_type>());
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::variance, S>::push(value_type input, std::true_type) noexcept
+{
+    // Exact sums of inputs and squared inputs
+    const auto square = square_type(input) * square_type(input);
+    if (super::full())
+    {
+        const value_type old_input = super::window.front();
+        super::sum.mean += typename super::sum_type(input) - typename super::sum_type(old_input);
+        sum.variance += square - square_type(old_input) * square_type(old_input);
+    }
+    else
+    {
+        super::sum.mean += typename super::sum_type(input);
+        sum.variance += square;
+    }
+    super::window.push_back(storage_type(input));
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::variance, S>::push(value_type input, std::false_type) noexcept
 {
     const value_type old_mean = super::mean();
     if (super::full())
     {
         const value_type old_input = super::window.front();
         super::sum.mean += input - old_input;
-        super::window.push_back(input);
-        sum.variance += delta(input, old_mean);
-        sum.variance -= delta(old_input, old_mean);
+        const value_type new_mean = super::mean();
+        sum.variance += (input - old_mean) * (input - new_mean);
+        sum.variance -= (old_input - old_mean) * (old_input - new_mean);
     }
     else
     {
         super::sum.mean += input;
-        super::window.push_back(input);
-        sum.variance += delta(input, old_mean);
+        const value_type new_mean = super::sum.mean / value_type(super::size() + 1);
+        sum.variance += (input - old_mean) * (input - new_mean);
+    }
+    // Store the input after updating the sums, which otherwise have to be
+    // reloaded because the store may alias them
+    super::window.push_back(storage_type(input));
+    if (super::advance())
+    {
+        super::resync();
+        resync();
     }
 }
 
-template <typename T, std::size_t N>
-auto basic_moment<T, N, with::variance>::variance() const noexcept -> value_type
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::variance, S>::variance() const noexcept -> result_type
 {
-    // Rounding errors can cause the variance to become negative
     const auto count = super::size();
     return (count > 0)
-        ? std::max(value_type(0), sum.variance / value_type(count))
-        : value_type(0);
+        ? normalize(count)
+        : result_type(0);
 }
 
-template <typename T, std::size_t N>
-auto basic_moment<T, N, with::variance>::unbiased_variance() const noexcept -> value_type
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::variance, S>::unbiased_variance() const noexcept -> result_type
 {
     // With Bessel's correction
-    // Rounding errors can cause the variance to become negative
     const auto count = super::size();
     return (count > 1)
-        ? std::max(value_type(0), sum.variance / (count - 1))
-        : value_type(0);
+        ? normalize(count - 1)
+        : result_type(0);
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::variance, S>::normalize(size_type divisor) const noexcept -> result_type
+{
+    if (std::is_integral<value_type>::value)
+    {
+        // (n * sum(x^2) - sum(x)^2) / n is exact before the division
+        const auto count = square_type(super::size());
+        const auto linear = square_type(super::sum.mean);
+        const auto numerator = count * sum.variance - linear * linear;
+        return result_type(numerator) / (result_type(count) * result_type(divisor));
+    }
+    // Rounding errors can cause the variance to become negative
+    return std::max(result_type(0), result_type(sum.variance) / result_type(divisor));
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::variance, S>::resync() noexcept
+{
+    sum.variance = super::template central_sum<2>(super::mean());
+}
+
+//-----------------------------------------------------------------------------
+// With skewness
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::skewness, S>::basic_moment() noexcept
+    : super()
+{
+}
+
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::skewness, S>::basic_moment(size_type capacity)
+    : super(capacity)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_moment<T, N, with::skewness, S>::basic_moment(ContiguousIterator begin,
+                                                 ContiguousIterator end) noexcept
+    : super(begin, end)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::skewness, S>::clear() noexcept
+{
+    super::clear();
+    sum.skewness = value_type(0);
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::skewness, S>::push(value_type value) noexcept
+{
+    const auto input = super::quantize(value);
+
+    // Use old sums
+    auto count = value_type(super::size());
+    auto mean = super::mean();
+    auto variance = super::sum.variance;
+    auto skewness = sum.skewness;
+
+    if (super::full())
+    {
+        // Remove oldest input by reversing its insertion
+        const value_type old_input = super::window.front();
+        const auto n = count;
+        count -= 1;
+        if (count > 0)
+        {
+            mean = (super::super::sum.mean - old_input) / count;
+            const auto delta = old_input - mean;
+            const auto delta_over_n = delta / n;
+            variance -= delta * delta_over_n * count;
+            skewness -= ((delta * delta_over_n * count * (n - 2)) - 3 * variance) * delta_over_n;
+        }
+        else
+        {
+            mean = variance = skewness = value_type(0);
+        }
+    }
+
+    const auto n = count + 1;
+    const auto delta = input - mean;
+    const auto delta_over_n = delta / n;
+    sum.skewness = skewness + ((delta * delta_over_n * count * (n - 2)) - 3 * variance) * delta_over_n;
+
+    super::push(input);
+    if (super::aligned())
+    {
+        resync();
+    }
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::skewness, S>::resync() noexcept
+{
+    // Lower sums have already been recalculated
+    sum.skewness = super::template central_sum<3>(super::mean());
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::skewness, S>::skewness() const noexcept -> value_type
+{
+    if (std::abs(sum.skewness) < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    if (super::sum.variance < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    return std::sqrt(value_type(super::size())) * sum.skewness / (std::sqrt(super::sum.variance) * super::sum.variance);
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::skewness, S>::unbiased_skewness() const noexcept -> value_type
+{
+    const auto count = value_type(size());
+    if (count < 3)
+        return value_type(0);
+    // Bias-correction from Octave manual
+    return skewness() * std::sqrt(count * (count - 1)) / (count - 2);
+}
+
+//-----------------------------------------------------------------------------
+// With kurtosis
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::kurtosis, S>::basic_moment() noexcept
+    : super()
+{
+}
+
+template <typename T, std::size_t N, typename S>
+basic_moment<T, N, with::kurtosis, S>::basic_moment(size_type capacity)
+    : super(capacity)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+template <typename ContiguousIterator>
+basic_moment<T, N, with::kurtosis, S>::basic_moment(ContiguousIterator begin,
+                                                 ContiguousIterator end) noexcept
+    : super(begin, end)
+{
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::kurtosis, S>::clear() noexcept
+{
+    super::clear();
+    sum.kurtosis = value_type(0);
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::kurtosis, S>::push(value_type value) noexcept
+{
+    const auto input = super::quantize(value);
+
+    // Use old sums
+    auto count = value_type(super::size());
+    auto mean = super::mean();
+    auto variance = super::super::sum.variance;
+    auto skewness = super::sum.skewness;
+    auto kurtosis = sum.kurtosis;
+
+    if (super::full())
+    {
+        // Remove oldest input by reversing its insertion
+        const value_type old_input = super::window.front();
+        const auto n = count;
+        count -= 1;
+        if (count > 0)
+        {
+            mean = (super::super::super::sum.mean - old_input) / count;
+            const auto delta = old_input - mean;
+            const auto delta_over_n = delta / n;
+            variance -= delta * delta_over_n * count;
+            skewness -= ((delta * delta_over_n * count * (n - 2)) - 3 * variance) * delta_over_n;
+            const auto expr = delta * delta_over_n * count * (n * (n - 3) + 3);
+            kurtosis -= ((expr + value_type(6) * variance) * delta_over_n - value_type(4) * skewness) * delta_over_n;
+        }
+        else
+        {
+            mean = variance = skewness = kurtosis = value_type(0);
+        }
+    }
+
+    const auto n = count + 1;
+    const auto delta = input - mean;
+    const auto delta_over_n = delta / n;
+    const auto expr = delta * delta_over_n * count * (n * (n - 3) + 3);
+    sum.kurtosis = kurtosis + ((expr + value_type(6) * variance) * delta_over_n - value_type(4) * skewness) * delta_over_n;
+
+    super::push(input);
+    if (super::aligned())
+    {
+        resync();
+    }
+}
+
+template <typename T, std::size_t N, typename S>
+void basic_moment<T, N, with::kurtosis, S>::resync() noexcept
+{
+    // Lower sums have already been recalculated
+    sum.kurtosis = super::template central_sum<4>(super::mean());
+}
+
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::kurtosis, S>::kurtosis() const noexcept -> value_type
+{
+    const auto variance = super::super::sum.variance;
+    if (sum.kurtosis < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    if (variance < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    return value_type(super::size()) * sum.kurtosis / (variance * variance);
 }
 
-template <typename T, std::size_t N>
-auto basic_moment<T, N, with::variance>::delta(value_type input, value_type old_mean) noexcept -> value_type
+template <typename T, std::size_t N, typename S>
+auto basic_moment<T, N, with::kurtosis, S>::unbiased_kurtosis() const noexcept -> value_type
 {
-    return (input - old_mean) * (input - super::mean());
+    const auto count = value_type(super::size());
+    if (count < 4)
+        return value_type(0);
+    if (sum.kurtosis < std::numeric_limits<value_type>::epsilon())
+        return value_type(0);
+    // Bias-correction from Octave manual
+    return value_type(3) + (count - 1) / ((count - 2) * (count - 3)) * ((count + 1) * kurtosis() - value_type(3) * (count - 1));
 }
 
 } // namespace window
@@ -0,0 +1,191 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//-----------------------------------------------------------------------------
+// Average without variance
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t... N>
+constexpr typename basic_multi_moment<T, with::mean, N...>::size_type basic_multi_moment<T, with::mean, N...>::horizon_count;
+
+template <typename T, std::size_t... N>
+constexpr typename basic_multi_moment<T, with::mean, N...>::size_type basic_multi_moment<T, with::mean, N...>::max_extent;
+
+template <typename T, std::size_t... N>
+constexpr typename basic_multi_moment<T, with::mean, N...>::size_type basic_multi_moment<T, with::mean, N...>::extents[];
+
+template <typename T, std::size_t... N>
+void basic_multi_moment<T, with::mean, N...>::clear() noexcept
+{
+    window.clear();
+    sum.mean.fill(value_type(0));
+}
+
+template <typename T, std::size_t... N>
+void basic_multi_moment<T, with::mean, N...>::push(value_type input) noexcept
+{
+    for (size_type horizon = 0; horizon < horizon_count; ++horizon)
+    {
+        sum.mean[horizon] += input - leaving(horizon);
+    }
+    window.push_back(input);
+    if (aligned())
+    {
+        resync();
+    }
+}
+
+template <typename T, std::size_t... N>
+auto basic_multi_moment<T, with::mean, N...>::capacity(size_type horizon) const noexcept -> size_type
+{
+    assert(horizon < horizon_count);
+
+    return extents[horizon];
+}
+
+template <typename T, std::size_t... N>
+auto basic_multi_moment<T, with::mean, N...>::size(size_type horizon) const noexcept -> size_type
+{
+    return std::min(window.size(), capacity(horizon));
+}
+
+template <typename T, std::size_t... N>
+auto basic_multi_moment<T, with::mean, N...>::mean(size_type horizon) const noexcept -> value_type
+{
+    const auto count = size(horizon);
+    if (count == 0)
+        return value_type();
+    return sum.mean[horizon] / value_type(count);
+}
+
+template <typename T, std::size_t... N>
+auto basic_multi_moment<T, with::mean, N...>::leaving(size_type horizon) const noexcept -> value_type
+{
+    // Input that leaves the horizon on the next push, or zero if the horizon
+    // is not full.
+    const auto extent = extents[horizon];
+    return (window.size() >= extent)
+        ? window[window.size() - extent]
+        : value_type(0);
+}
+
+template <typename T, std::size_t... N>
+bool basic_multi_moment<T, with::mean, N...>::aligned() const noexcept
+{
+    return window.full() && (window.array_two().second == 0);
+}
+
+template <typename T, std::size_t... N>
+void basic_multi_moment<T, with::mean, N...>::resync() noexcept
+{
+    // The window is a single segment when aligned
+    const auto segment = window.array_one();
+    const auto last = segment.first + segment.second;
+    for (size_type horizon = 0; horizon < horizon_count; ++horizon)
+    {
+        value_type result(0);
+        for (auto it = last - size(horizon); it != last; ++it)
+        {
+            result += *it;
+        }
+        sum.mean[horizon] = result;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Average with variance
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t... N>
+void basic_multi_moment<T, with::variance, N...>::clear() noexcept
+{
+    super::clear();
+    sum.variance.fill(value_type(0));
+}
+
+template <typename T, std::size_t... N>
+void basic_multi_moment<T, with::variance, N...>::push(value_type input) noexcept
+{
+    for (size_type horizon = 0; horizon < horizon_count; ++horizon)
+    {
+        const auto old_mean = super::mean(horizon);
+        const bool full = super::size(horizon) == super::capacity(horizon);
+        const auto old_input = super::leaving(horizon);
+        auto& linear = super::sum.mean[horizon];
+        linear += input - old_input;
+        const auto count = full ? super::size(horizon) : super::size(horizon) + 1;
+        const auto new_mean = linear / value_type(count);
+        sum.variance[horizon] += (input - old_mean) * (input - new_mean);
+        if (full)
+        {
+            sum.variance[horizon] -= (old_input - old_mean) * (old_input - new_mean);
+        }
+    }
+    super::window.push_back(input);
+    if (super::aligned())
+    {
+        super::resync();
+        resync();
+    }
+}
+
+template <typename T, std::size_t... N>
+auto basic_multi_moment<T, with::variance, N...>::variance(size_type horizon) const noexcept -> value_type
+{
+    // Rounding errors can cause the variance to become negative
+    const auto count = super::size(horizon);
+    return (count > 0)
+        ? std::max(value_type(0), sum.variance[horizon] / value_type(count))
+        : value_type(0);
+}
+
+template <typename T, std::size_t... N>
+auto basic_multi_moment<T, with::variance, N...>::unbiased_variance(size_type horizon) const noexcept -> value_type
+{
+    // With Bessel's correction
+    // Rounding errors can cause the variance to become negative
+    const auto count = super::size(horizon);
+    return (count > 1)
+        ? std::max(value_type(0), sum.variance[horizon] / value_type(count - 1))
+        : value_type(0);
+}
+
+template <typename T, std::size_t... N>
+void basic_multi_moment<T, with::variance, N...>::resync() noexcept
+{
+    // Means have already been recalculated
+    const auto segment = super::window.array_one();
+    const auto last = segment.first + segment.second;
+    for (size_type horizon = 0; horizon < horizon_count; ++horizon)
+    {
+        const auto mean = super::mean(horizon);
+        value_type result(0);
+        for (auto it = last - super::size(horizon); it != last; ++it)
+        {
+            const auto delta = *it - mean;
+            result += delta * delta;
+        }
+        sum.variance[horizon] = result;
+    }
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
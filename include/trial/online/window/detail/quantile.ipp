@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+template <typename T, std::size_t N, typename... Quantiles>
+constexpr typename basic_quantile<T, N, Quantiles...>::size_type basic_quantile<T, N, Quantiles...>::fixed_block_length;
+
+template <typename T, std::size_t N, typename... Quantiles>
+constexpr typename basic_quantile<T, N, Quantiles...>::size_type basic_quantile<T, N, Quantiles...>::fixed_block_count;
+
+template <typename T, std::size_t N, typename... Quantiles>
+basic_quantile<T, N, Quantiles...>::basic_quantile() noexcept
+    : member{fixed_block_length, fixed_block_count, 1, 0}
+{
+    static_assert(N != dynamic_extent, "Dynamic window length must be passed to constructor");
+
+    lengths[0] = 0;
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+basic_quantile<T, N, Quantiles...>::basic_quantile(size_type capacity)
+    : window(capacity),
+      member{online::detail::ceil_sqrt(capacity), 0, 1, 0}
+{
+    static_assert(N == dynamic_extent, "Window length is fixed by template parameter");
+
+    member.block_count = (capacity + member.block_length - 1) / member.block_length;
+    values.resize(2 * member.block_count * member.block_length);
+    lengths.resize(member.block_count);
+    lengths[0] = 0;
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+void basic_quantile<T, N, Quantiles...>::clear() noexcept
+{
+    window.clear();
+    member.blocks = 1;
+    member.pending = 0;
+    lengths[0] = 0;
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+auto basic_quantile<T, N, Quantiles...>::capacity() const noexcept -> size_type
+{
+    return window.capacity();
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+bool basic_quantile<T, N, Quantiles...>::empty() const noexcept
+{
+    return window.empty();
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+bool basic_quantile<T, N, Quantiles...>::full() const noexcept
+{
+    return window.full();
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+auto basic_quantile<T, N, Quantiles...>::size() const noexcept -> size_type
+{
+    return window.size();
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+void basic_quantile<T, N, Quantiles...>::push(value_type input) noexcept
+{
+    // Blocks can only overflow if they receive more insertions than their
+    // length since the last rebuild.
+    if (member.pending == member.block_length)
+    {
+        rebuild();
+    }
+    ++member.pending;
+
+    if (window.full())
+    {
+        erase(window.front());
+    }
+    insert(input);
+    window.push_back(input);
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+template <typename Q>
+auto basic_quantile<T, N, Quantiles...>::value() const noexcept -> value_type
+{
+    using index_type = boost::mp11::mp_find<QuantileList, Q>;
+
+    return get<index_type::value>();
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+template <std::size_t Index>
+auto basic_quantile<T, N, Quantiles...>::get() const noexcept -> value_type
+{
+    static_assert((Index <= boost::mp11::mp_find<QuantileList, quantile::maximum_ratio>::value), "Index must be within range");
+
+    using ratio_type = boost::mp11::mp_at_c<QuantileList, Index>;
+
+    return interpolate(ratio_type::num / value_type(ratio_type::den));
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+auto basic_quantile<T, N, Quantiles...>::order(size_type rank) const noexcept -> value_type
+{
+    assert(rank < size());
+
+    for (size_type index = 0; index < member.blocks; ++index)
+    {
+        if (rank < lengths[index])
+            return block(index)[rank];
+        rank -= lengths[index];
+    }
+    return value_type();
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N, typename... Quantiles>
+auto basic_quantile<T, N, Quantiles...>::interpolate(value_type ratio) const noexcept -> value_type
+{
+    if (empty())
+        return value_type();
+
+    const auto position = (size() - 1) * ratio;
+    const auto rank = size_type(position);
+    const auto lower = order(rank);
+    const auto slope = position - rank;
+    if ((slope == 0) || (rank + 1 >= size()))
+        return lower;
+    return lower + slope * (order(rank + 1) - lower);
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+auto basic_quantile<T, N, Quantiles...>::block(size_type index) noexcept -> value_type*
+{
+    return values.data() + 2 * member.block_length * index;
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+auto basic_quantile<T, N, Quantiles...>::block(size_type index) const noexcept -> const value_type*
+{
+    return values.data() + 2 * member.block_length * index;
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+auto basic_quantile<T, N, Quantiles...>::locate(value_type input) const noexcept -> size_type
+{
+    // First non-empty block whose largest value is not less than input,
+    // otherwise the last non-empty block.
+    size_type result = 0;
+    for (size_type index = 0; index < member.blocks; ++index)
+    {
+        const auto length = lengths[index];
+        if (length == 0)
+            continue;
+        result = index;
+        if (!(block(index)[length - 1] < input))
+            break;
+    }
+    return result;
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+void basic_quantile<T, N, Quantiles...>::insert(value_type input) noexcept
+{
+    const auto index = locate(input);
+    auto first = block(index);
+    auto last = first + lengths[index];
+    assert(lengths[index] < 2 * member.block_length);
+
+    auto where = std::upper_bound(first, last, input);
+    std::copy_backward(where, last, last + 1);
+    *where = input;
+    ++lengths[index];
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+void basic_quantile<T, N, Quantiles...>::erase(value_type input) noexcept
+{
+    const auto index = locate(input);
+    auto first = block(index);
+    auto last = first + lengths[index];
+
+    auto where = std::lower_bound(first, last, input);
+    assert(where != last);
+    std::copy(where + 1, last, where);
+    --lengths[index];
+}
+
+template <typename T, std::size_t N, typename... Quantiles>
+void basic_quantile<T, N, Quantiles...>::rebuild() noexcept
+{
+    // Compact the sorted values to the front. Values only move towards the
+    // front because no block is longer than twice the block length.
+    auto output = values.data();
+    for (size_type index = 0; index < member.blocks; ++index)
+    {
+        const auto first = block(index);
+        output = std::copy(first, first + lengths[index], output);
+    }
+
+    // Spread the values evenly into blocks starting from the back, where
+    // values only move towards the back.
+    const auto count = size();
+    member.blocks = std::max<size_type>(1, (count + member.block_length - 1) / member.block_length);
+    for (size_type index = member.blocks; index > 0; --index)
+    {
+        const auto offset = (index - 1) * member.block_length;
+        const auto length = std::min(member.block_length, count - offset);
+        const auto first = values.data() + offset;
+        std::copy_backward(first, first + length, block(index - 1) + length);
+        lengths[index - 1] = length;
+    }
+    member.pending = 0;
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
@@ -8,6 +8,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 namespace trial
 {
 namespace online
@@ -15,11 +17,17 @@ namespace online
 namespace window
 {
 
+template <typename T, std::size_t W>
+regression<T, W>::regression(size_type capacity)
+    : covariance(capacity)
+{
+}
+
 template <typename T, std::size_t W>
 void regression<T, W>::clear() noexcept
 {
     covariance::clear();
-    x_moment.clear();
+    sum.xx = value_type(0);
 }
 
 template <typename T, std::size_t W>
@@ -31,26 +39,76 @@ auto regression<T, W>::size() const noexcept -> size_type
 template <typename T, std::size_t W>
 void regression<T, W>::push(value_type x, value_type y) noexcept
 {
+    const bool full = covariance::full();
+    const auto front_x = full ? value_type(covariance::x_storage.data()[covariance::front()]) : value_type(0);
+    const auto old_mean = x_mean();
     covariance::push(x, y);
-    x_moment.push(x);
+    if (covariance::aligned())
+    {
+        resync();
+    }
+    else
+    {
+        // Use the stored precision like the covariance
+        const auto input = value_type(covariance::x_storage.data()[covariance::back()]);
+        const auto new_mean = x_mean();
+        sum.xx += (input - old_mean) * (input - new_mean);
+        if (full)
+        {
+            sum.xx -= (front_x - old_mean) * (front_x - new_mean);
+        }
+    }
 }
 
 template <typename T, std::size_t W>
 auto regression<T, W>::at(value_type position) const noexcept -> value_type
 {
     const auto y_mean = covariance::sum.y / covariance::size();
-    return y_mean - slope() * (x_moment.mean() - position);
+    return y_mean - slope() * (x_mean() - position);
 }
 
 template <typename T, std::size_t W>
 auto regression<T, W>::slope() const noexcept -> value_type
 {
-    const auto divisor = x_moment.variance();
+    const auto divisor = x_variance();
     return (divisor == 0)
         ? value_type(0)
         : covariance::variance() / divisor;
 }
 
+template <typename T, std::size_t W>
+auto regression<T, W>::x_variance() const noexcept -> value_type
+{
+    const auto count = covariance::size();
+    if (count == 0)
+        return value_type(0);
+    // Rounding errors can cause the variance to become negative
+    return std::max(value_type(0), sum.xx / count);
+}
+
+template <typename T, std::size_t W>
+auto regression<T, W>::x_mean() const noexcept -> value_type
+{
+    const auto count = covariance::size();
+    return (count > 0)
+        ? covariance::sum.x / count
+        : value_type(0);
+}
+
+template <typename T, std::size_t W>
+void regression<T, W>::resync() noexcept
+{
+    // The inputs are stored in order from index zero when aligned
+    const auto xs = covariance::x_storage.data();
+    const auto mean = x_mean();
+    sum.xx = value_type(0);
+    for (size_type k = 0; k < covariance::size(); ++k)
+    {
+        const auto delta = value_type(xs[k]) - mean;
+        sum.xx += delta * delta;
+    }
+}
+
 } // namespace window
 } // namespace online
 } // namespace trial
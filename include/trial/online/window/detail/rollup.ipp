@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <utility>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+constexpr typename rollup<F, K, Fanout...>::size_type rollup<F, K, Fanout...>::level_count;
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+rollup<F, K, Fanout...>::rollup() noexcept
+    : time(0)
+{
+    const size_type fanouts[] = { Fanout..., 1 };
+    spans[0] = 1;
+    for (size_type level = 1; level < level_count; ++level)
+    {
+        assert(fanouts[level - 1] > 1);
+        spans[level] = spans[level - 1] * fanouts[level - 1];
+    }
+    counts.fill(0);
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+void rollup<F, K, Fanout...>::clear() noexcept
+{
+    for (size_type level = 0; level < level_count; ++level)
+    {
+        buckets[level].clear();
+        open[level] = filter_type();
+    }
+    counts.fill(0);
+    time = 0;
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+template <typename... Args>
+void rollup<F, K, Fanout...>::push(Args&&... args)
+{
+    open[0].push(std::forward<Args>(args)...);
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+void rollup<F, K, Fanout...>::advance() noexcept
+{
+    ++time;
+    close(0);
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+std::uint64_t rollup<F, K, Fanout...>::slices() const noexcept
+{
+    return time;
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+auto rollup<F, K, Fanout...>::span(size_type level) const noexcept -> size_type
+{
+    assert(level < level_count);
+
+    return spans[level];
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+auto rollup<F, K, Fanout...>::size(size_type level) const noexcept -> size_type
+{
+    assert(level < level_count);
+
+    return buckets[level].size();
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+auto rollup<F, K, Fanout...>::at(size_type level, size_type position) const noexcept -> const filter_type&
+{
+    assert(level < level_count);
+    assert(position < size(level));
+
+    return buckets[level][position];
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+auto rollup<F, K, Fanout...>::current() const noexcept -> const filter_type&
+{
+    return open[0];
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+auto rollup<F, K, Fanout...>::value(std::uint64_t count) const -> filter_type
+{
+    filter_type result;
+    const std::uint64_t first = (count < time) ? time - count : 0;
+    // Walk backwards from the end of the latest closed slice
+    std::uint64_t last = time;
+    while (last > first)
+    {
+        size_type chosen = level_count;
+        for (size_type level = 0; level < level_count; ++level)
+        {
+            const auto span = spans[level];
+            if (last % span != 0)
+                break;
+            // Bucket ending at last is retained if it is among the latest
+            // size(level) closed buckets on level
+            const auto age = time / span - last / span;
+            if (age >= buckets[level].size())
+                continue;
+            if (last - first >= span)
+            {
+                chosen = level;
+            }
+            else if (chosen == level_count)
+            {
+                // Widen range to finest retained bucket
+                result += buckets[level][buckets[level].size() - 1 - age];
+                return result;
+            }
+        }
+        if (chosen == level_count)
+            break;
+        const auto age = time / spans[chosen] - last / spans[chosen];
+        result += buckets[chosen][buckets[chosen].size() - 1 - age];
+        last -= spans[chosen];
+    }
+    return result;
+}
+
+template <typename F, std::size_t K, std::size_t... Fanout>
+void rollup<F, K, Fanout...>::close(size_type level) noexcept
+{
+    for (;;)
+    {
+        buckets[level].push_back(std::move(open[level]));
+        open[level] = filter_type();
+        if (level + 1 == level_count)
+            break;
+        open[level + 1] += buckets[level][buckets[level].size() - 1];
+        if (++counts[level + 1] < spans[level + 1] / spans[level])
+            break;
+        counts[level + 1] = 0;
+        ++level;
+    }
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
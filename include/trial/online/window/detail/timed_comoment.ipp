@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+template <typename T, typename C>
+basic_timed_comoment<T, with::variance, C>::basic_timed_comoment(duration window)
+    : member{window, 0}
+{
+    assert(window > duration::zero());
+}
+
+template <typename T, typename C>
+void basic_timed_comoment<T, with::variance, C>::clear() noexcept
+{
+    queue.clear();
+    member.removed = 0;
+    sum.x = sum.y = sum.xy = value_type(0);
+}
+
+template <typename T, typename C>
+void basic_timed_comoment<T, with::variance, C>::push(time_point now,
+                                                      value_type x,
+                                                      value_type y)
+{
+    assert(queue.empty() || !(now < queue.back().time));
+
+    expire(now);
+    sum.x += x;
+    sum.y += y;
+    sum.xy += x * y;
+    queue.push_back({now, x, y});
+}
+
+template <typename T, typename C>
+void basic_timed_comoment<T, with::variance, C>::expire(time_point now)
+{
+    while (!queue.empty() && (now - queue.front().time >= member.window))
+    {
+        const auto& front = queue.front();
+        sum.x -= front.x;
+        sum.y -= front.y;
+        sum.xy -= front.x * front.y;
+        queue.pop_front();
+        ++member.removed;
+    }
+    if (member.removed > 0 && member.removed >= queue.size())
+    {
+        resync();
+    }
+}
+
+template <typename T, typename C>
+auto basic_timed_comoment<T, with::variance, C>::window() const noexcept -> duration
+{
+    return member.window;
+}
+
+template <typename T, typename C>
+bool basic_timed_comoment<T, with::variance, C>::empty() const noexcept
+{
+    return queue.empty();
+}
+
+template <typename T, typename C>
+auto basic_timed_comoment<T, with::variance, C>::size() const noexcept -> size_type
+{
+    return queue.size();
+}
+
+template <typename T, typename C>
+auto basic_timed_comoment<T, with::variance, C>::cosum() const noexcept -> value_type
+{
+    return sum.xy - sum.x * sum.y / size();
+}
+
+template <typename T, typename C>
+auto basic_timed_comoment<T, with::variance, C>::variance() const noexcept -> value_type
+{
+    if (size() > 0)
+        return cosum() / size();
+    return value_type(0);
+}
+
+template <typename T, typename C>
+auto basic_timed_comoment<T, with::variance, C>::unbiased_variance() const noexcept -> value_type
+{
+    if (size() > 1)
+        return cosum() / (size() - 1);
+    return value_type(0);
+}
+
+template <typename T, typename C>
+void basic_timed_comoment<T, with::variance, C>::resync() noexcept
+{
+    sum.x = sum.y = sum.xy = value_type(0);
+    for (size_type k = 0; k < queue.size(); ++k)
+    {
+        const auto& element = queue[k];
+        sum.x += element.x;
+        sum.y += element.y;
+        sum.xy += element.x * element.y;
+    }
+    member.removed = 0;
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
@@ -0,0 +1,218 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <algorithm>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//-----------------------------------------------------------------------------
+// Average without variance
+//-----------------------------------------------------------------------------
+
+template <typename T, typename C>
+basic_timed_moment<T, with::mean, C>::basic_timed_moment(duration window)
+    : member{window, 0}
+{
+    assert(window > duration::zero());
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::mean, C>::clear() noexcept
+{
+    queue.clear();
+    member.removed = 0;
+    sum.mean = value_type(0);
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::mean, C>::push(time_point now, value_type input)
+{
+    expire(now);
+    add(now, input);
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::mean, C>::expire(time_point now)
+{
+    while (expired(now))
+    {
+        remove();
+    }
+    if (unsynced())
+    {
+        resync();
+    }
+}
+
+template <typename T, typename C>
+auto basic_timed_moment<T, with::mean, C>::window() const noexcept -> duration
+{
+    return member.window;
+}
+
+template <typename T, typename C>
+bool basic_timed_moment<T, with::mean, C>::empty() const noexcept
+{
+    return queue.empty();
+}
+
+template <typename T, typename C>
+auto basic_timed_moment<T, with::mean, C>::size() const noexcept -> size_type
+{
+    return queue.size();
+}
+
+template <typename T, typename C>
+auto basic_timed_moment<T, with::mean, C>::mean() const noexcept -> value_type
+{
+    if (empty())
+        return value_type();
+    return sum.mean / value_type(size());
+}
+
+template <typename T, typename C>
+bool basic_timed_moment<T, with::mean, C>::expired(time_point now) const noexcept
+{
+    return !queue.empty() && (now - queue.front().time >= member.window);
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::mean, C>::add(time_point now, value_type input)
+{
+    assert(queue.empty() || !(now < queue.back().time));
+
+    sum.mean += input;
+    queue.push_back({now, input});
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::mean, C>::remove()
+{
+    sum.mean -= queue.front().value;
+    queue.pop_front();
+    ++member.removed;
+}
+
+template <typename T, typename C>
+bool basic_timed_moment<T, with::mean, C>::unsynced() const noexcept
+{
+    return member.removed > 0 && member.removed >= queue.size();
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::mean, C>::resync() noexcept
+{
+    sum.mean = value_type(0);
+    for (size_type k = 0; k < queue.size(); ++k)
+    {
+        sum.mean += queue[k].value;
+    }
+    member.removed = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Average with variance
+//-----------------------------------------------------------------------------
+
+template <typename T, typename C>
+basic_timed_moment<T, with::variance, C>::basic_timed_moment(duration window)
+    : super(window)
+{
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::variance, C>::clear() noexcept
+{
+    super::clear();
+    sum.variance = value_type(0);
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::variance, C>::push(time_point now, value_type input)
+{
+    expire(now);
+    add(now, input);
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::variance, C>::expire(time_point now)
+{
+    while (super::expired(now))
+    {
+        remove();
+    }
+    if (super::unsynced())
+    {
+        super::resync();
+        resync();
+    }
+}
+
+template <typename T, typename C>
+auto basic_timed_moment<T, with::variance, C>::variance() const noexcept -> value_type
+{
+    // Rounding errors can cause the variance to become negative
+    const auto count = super::size();
+    return (count > 0)
+        ? std::max(value_type(0), sum.variance / value_type(count))
+        : value_type(0);
+}
+
+template <typename T, typename C>
+auto basic_timed_moment<T, with::variance, C>::unbiased_variance() const noexcept -> value_type
+{
+    // With Bessel's correction
+    // Rounding errors can cause the variance to become negative
+    const auto count = super::size();
+    return (count > 1)
+        ? std::max(value_type(0), sum.variance / value_type(count - 1))
+        : value_type(0);
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::variance, C>::add(time_point now, value_type input)
+{
+    const auto old_mean = super::mean();
+    super::add(now, input);
+    sum.variance += (input - old_mean) * (input - super::mean());
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::variance, C>::remove()
+{
+    // Reverse the insertion of the oldest input
+    const auto old_input = super::queue.front().value;
+    const auto old_mean = super::mean();
+    super::remove();
+    sum.variance -= (old_input - old_mean) * (old_input - super::mean());
+}
+
+template <typename T, typename C>
+void basic_timed_moment<T, with::variance, C>::resync() noexcept
+{
+    // Mean has already been recalculated
+    const auto mean = super::mean();
+    sum.variance = value_type(0);
+    for (size_type k = 0; k < super::queue.size(); ++k)
+    {
+        const auto delta = super::queue[k].value - mean;
+        sum.variance += delta * delta;
+    }
+}
+
+} // namespace window
+} // namespace online
+} // namespace trial
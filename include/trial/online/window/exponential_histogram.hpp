@@ -0,0 +1,101 @@
+#ifndef TRIAL_ONLINE_WINDOW_EXPONENTIAL_HISTOGRAM_HPP
+#define TRIAL_ONLINE_WINDOW_EXPONENTIAL_HISTOGRAM_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <type_traits>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//! @brief Approximate sum over a sliding window.
+//!
+//! Exponential histogram of Datar, Gionis, Indyk, and Motwani, "Maintaining
+//! Stream Statistics over Sliding Windows", 2002.
+//!
+//! Inputs are non-negative integers, where an input of value v counts as v
+//! unit inputs at the same position. Buckets have sizes that are powers of
+//! two, and the timestamp of a bucket is the position of its newest unit.
+//! There are at most k + 1 buckets of each size, where k = ceil(1 / epsilon),
+//! and the two oldest buckets of a size are merged into a bucket of twice the
+//! size when that limit is exceeded.
+//!
+//! Only the oldest bucket can straddle the window boundary, so half of it is
+//! counted. Every smaller size retains at least k buckets, so the relative
+//! error of the sum is at most epsilon.
+//! Memory is O((1 / epsilon) log(N R)) for a window of N inputs no larger
+//! than R.
+
+template <typename T = std::size_t>
+class exponential_histogram
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "T must be an unsigned integral type");
+
+    //! @brief Creates histogram over the latest @c window inputs.
+    exponential_histogram(size_type window, double epsilon);
+
+    void clear() noexcept;
+    void push(value_type input);
+
+    //! @brief Returns window length.
+    size_type capacity() const noexcept;
+
+    //! @brief Returns number of inputs in window.
+    size_type size() const noexcept;
+
+    bool empty() const noexcept;
+
+    //! @brief Returns approximate sum of inputs in window.
+    value_type sum() const noexcept;
+
+    //! @brief Returns maximum absolute error of sum().
+    value_type error() const noexcept;
+
+    //! @brief Returns number of buckets.
+    size_type buckets() const noexcept;
+
+protected:
+    using timestamp_type = std::uint64_t;
+
+    void expire() noexcept;
+    void insert(value_type);
+
+protected:
+    // Timestamps of buckets of size 2^level ordered from oldest to newest
+    std::vector<std::vector<timestamp_type>> levels;
+    std::vector<timestamp_type> promoted;
+    struct
+    {
+        size_type window;
+        size_type limit;
+        timestamp_type time;
+        value_type total;
+    } member;
+};
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/exponential_histogram.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_EXPONENTIAL_HISTOGRAM_HPP
@@ -0,0 +1,111 @@
+#ifndef TRIAL_ONLINE_WINDOW_EXTREME_HPP
+#define TRIAL_ONLINE_WINDOW_EXTREME_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <trial/online/circular_array.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//! @brief Minimum and maximum over a sliding window.
+//!
+//! Keeps an ascending queue of minimum candidates and a descending queue of
+//! maximum candidates. A push discards the candidates that are dominated by
+//! the new value, so the push is amortized O(1) and queries are O(1).
+//!
+//! If several values in the window are equal to the extreme, then the oldest
+//! of them is reported.
+
+template <typename T, std::size_t N>
+class basic_extreme
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static_assert(N > 0, "N must be larger than zero");
+    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
+
+    //! @brief Creates filter with fixed window length.
+    basic_extreme() noexcept = default;
+
+    //! @brief Creates filter with dynamic window length.
+    explicit basic_extreme(size_type capacity);
+
+    void clear() noexcept;
+    void push(value_type input) noexcept;
+
+    size_type capacity() const noexcept;
+    bool empty() const noexcept;
+    bool full() const noexcept;
+    size_type size() const noexcept;
+
+    //! @brief Returns smallest value in window.
+    //!
+    //! @pre !empty()
+    value_type min() const noexcept;
+
+    //! @brief Returns largest value in window.
+    //!
+    //! @pre !empty()
+    value_type max() const noexcept;
+
+    //! @brief Returns position of smallest value in window.
+    //!
+    //! The oldest value in the window has position zero.
+    //!
+    //! @pre !empty()
+    size_type argmin() const noexcept;
+
+    //! @brief Returns position of largest value in window.
+    //!
+    //! The oldest value in the window has position zero.
+    //!
+    //! @pre !empty()
+    size_type argmax() const noexcept;
+
+protected:
+    struct element_type
+    {
+        size_type sequence;
+        value_type value;
+    };
+
+    size_type position(size_type sequence) const noexcept;
+
+protected:
+    circular_array<element_type, N> minima;
+    circular_array<element_type, N> maxima;
+    struct
+    {
+        size_type count = 0;
+    } member;
+};
+
+// Convenience
+
+template <typename T, std::size_t N>
+using extreme = basic_extreme<T, N>;
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/extreme.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_EXTREME_HPP
@@ -0,0 +1,208 @@
+#ifndef TRIAL_ONLINE_WINDOW_LAZY_MOMENT_HPP
+#define TRIAL_ONLINE_WINDOW_LAZY_MOMENT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <trial/online/with.hpp>
+#include <trial/online/circular_array.hpp>
+#include <trial/online/window/moment.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//! @brief Moments over a sliding window calculated on demand.
+//!
+//! Has the same interface as basic_moment, but push only stores the input in
+//! the window. The moments are calculated from the window when they are
+//! queried, which is O(N) per query. Skewness and kurtosis queries make
+//! three passes over the window; one for the mean and one for each central
+//! sum.
+//!
+//! This is preferable when inputs arrive much more frequently than the
+//! moments are queried.
+//!
+//! The window is reduced segment by segment with several independent
+//! accumulators, so the compiler can vectorize the reductions without
+//! reassociating floating-point operations.
+
+template <typename T, std::size_t N, online::with Moment, typename Storage = T>
+class basic_lazy_moment;
+
+template <typename T, std::size_t N, typename Storage>
+class basic_lazy_moment<T, N, with::mean, Storage>
+{
+public:
+    using value_type = T;
+    using storage_type = Storage;
+    using size_type = std::size_t;
+
+    static_assert(N > 0, "N must be larger than zero");
+    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
+    static_assert((!std::is_same<T, bool>::value), "T cannot be bool");
+    static_assert(std::is_arithmetic<Storage>::value, "Storage must be an arithmetic type");
+
+    //! @brief Creates filter with fixed window length.
+    basic_lazy_moment() noexcept;
+
+    //! @brief Creates filter with dynamic window length.
+    //!
+    //! The window is allocated on the heap.
+    explicit basic_lazy_moment(size_type capacity);
+
+    //! @brief Creates filter with dynamic window length.
+    //!
+    //! The window is stored in the range from @c begin to @c end. The range
+    //! must outlive the filter.
+    template <typename ContiguousIterator>
+    basic_lazy_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
+    void clear() noexcept;
+    void push(value_type value) noexcept;
+
+    size_type capacity() const noexcept;
+    bool empty() const noexcept;
+    bool full() const noexcept;
+    value_type mean() const noexcept;
+    size_type size() const noexcept;
+
+protected:
+    using sum_type = typename detail::moment_traits<value_type>::sum_type;
+
+    template <std::size_t Power, typename R>
+    R central_sum(R center) const noexcept;
+
+protected:
+    circular_array<storage_type, N> window;
+};
+
+template <typename T, std::size_t N, typename Storage>
+class basic_lazy_moment<T, N, with::variance, Storage>
+    : protected basic_lazy_moment<T, N, with::mean, Storage>
+{
+protected:
+    using super = basic_lazy_moment<T, N, with::mean, Storage>;
+
+public:
+    using typename super::value_type;
+    using typename super::storage_type;
+    using typename super::size_type;
+    using result_type = typename detail::moment_traits<value_type>::result_type;
+
+    basic_lazy_moment() noexcept;
+    explicit basic_lazy_moment(size_type capacity);
+    template <typename ContiguousIterator>
+    basic_lazy_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
+    using super::clear;
+    using super::push;
+    using super::capacity;
+    using super::empty;
+    using super::full;
+    using super::mean;
+    using super::size;
+    result_type variance() const noexcept;
+    result_type unbiased_variance() const noexcept;
+
+protected:
+    using square_type = typename detail::moment_traits<value_type>::square_type;
+
+    result_type normalize(size_type divisor) const noexcept;
+};
+
+template <typename T, std::size_t N, typename Storage>
+class basic_lazy_moment<T, N, with::skewness, Storage>
+    : protected basic_lazy_moment<T, N, with::variance, Storage>
+{
+protected:
+    using super = basic_lazy_moment<T, N, with::variance, Storage>;
+
+public:
+    using typename super::value_type;
+    using typename super::storage_type;
+    using typename super::size_type;
+
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+
+    basic_lazy_moment() noexcept;
+    explicit basic_lazy_moment(size_type capacity);
+    template <typename ContiguousIterator>
+    basic_lazy_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
+    using super::clear;
+    using super::push;
+    using super::capacity;
+    using super::empty;
+    using super::full;
+    using super::mean;
+    using super::size;
+    using super::variance;
+    using super::unbiased_variance;
+    value_type skewness() const noexcept;
+    value_type unbiased_skewness() const noexcept;
+};
+
+template <typename T, std::size_t N, typename Storage>
+class basic_lazy_moment<T, N, with::kurtosis, Storage>
+    : protected basic_lazy_moment<T, N, with::skewness, Storage>
+{
+protected:
+    using super = basic_lazy_moment<T, N, with::skewness, Storage>;
+
+public:
+    using typename super::value_type;
+    using typename super::storage_type;
+    using typename super::size_type;
+
+    basic_lazy_moment() noexcept;
+    explicit basic_lazy_moment(size_type capacity);
+    template <typename ContiguousIterator>
+    basic_lazy_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
+    using super::clear;
+    using super::push;
+    using super::capacity;
+    using super::empty;
+    using super::full;
+    using super::mean;
+    using super::size;
+    using super::variance;
+    using super::unbiased_variance;
+    using super::skewness;
+    using super::unbiased_skewness;
+    value_type kurtosis() const noexcept;
+    value_type unbiased_kurtosis() const noexcept;
+};
+
+template <typename T, std::size_t N>
+using lazy_moment = basic_lazy_moment<T, N, with::mean>;
+
+template <typename T, std::size_t N>
+using lazy_moment_variance = basic_lazy_moment<T, N, with::variance>;
+
+template <typename T, std::size_t N>
+using lazy_moment_skewness = basic_lazy_moment<T, N, with::skewness>;
+
+template <typename T, std::size_t N>
+using lazy_moment_kurtosis = basic_lazy_moment<T, N, with::kurtosis>;
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/lazy_moment.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_LAZY_MOMENT_HPP
@@ -12,9 +12,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cstddef> // std::size_t
+#include <cstdint>
 #include <type_traits>
 #include <trial/online/with.hpp>
-#include <trial/online/circular_span.hpp>
+#include <trial/online/circular_array.hpp>
 
 namespace trial
 {
@@ -22,23 +23,91 @@ namespace online
 {
 namespace window
 {
+namespace detail
+{
+
+template <typename T, bool = std::is_integral<T>::value>
+struct moment_traits
+{
+    using sum_type = T;
+    using square_type = T;
+    using result_type = T;
+};
+
+// Integer sums are exact as long as they do not overflow the wide types.
+
+template <typename T>
+struct moment_traits<T, true>
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef __int128 signed_square_type;
+    __extension__ typedef unsigned __int128 unsigned_square_type;
+#else
+    using signed_square_type = std::int64_t;
+    using unsigned_square_type = std::uint64_t;
+#endif
+
+    using sum_type = typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type;
+    using square_type = typename std::conditional<std::is_signed<T>::value, signed_square_type, unsigned_square_type>::type;
+    using result_type = double;
+};
+
+} // namespace detail
 
-template <typename T, std::size_t N, online::with Moment>
+//! @brief Moments over a sliding window.
+//!
+//! The window length is either given by @c N, in which case the window is
+//! stored inside the filter, or it is given at construction when @c N is
+//! @c dynamic_extent, in which case the window is stored on the heap or in
+//! externally supplied storage.
+//!
+//! Filters with a fixed window length are trivially copyable.
+//!
+//! Floating-point sums are updated incrementally, which accumulates rounding
+//! errors over time. The sums are therefore recalculated exactly from the
+//! window every time the window has been entirely replaced, which adds an
+//! amortized O(1) cost per push.
+//!
+//! Integer sums are kept exactly in wide integers, and are only converted to
+//! floating-point when the variance is queried. The mean of integers is
+//! rounded towards zero.
+//!
+//! The window stores the inputs as @c Storage, which can be a narrower type
+//! than @c T to reduce the memory footprint, while the sums are kept as @c T.
+//! Inputs are converted to @c Storage before they are added to the sums, so
+//! the sums remain consistent with the window.
+
+template <typename T, std::size_t N, online::with Moment, typename Storage = T>
 class basic_moment;
 
-template <typename T, std::size_t N>
-class basic_moment<T, N, with::mean>
+template <typename T, std::size_t N, typename Storage>
+class basic_moment<T, N, with::mean, Storage>
 {
 public:
     using value_type = T;
+    using storage_type = Storage;
     using size_type = std::size_t;
 
     static_assert(N > 0, "N must be larger than zero");
     static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
     static_assert((!std::is_same<T, bool>::value), "T cannot be bool");
+    static_assert(std::is_arithmetic<Storage>::value, "Storage must be an arithmetic type");
 
+    //! @brief Creates filter with fixed window length.
     basic_moment() noexcept;
 
+    //! @brief Creates filter with dynamic window length.
+    //!
+    //! The window is allocated on the heap.
+    explicit basic_moment(size_type capacity);
+
+    //! @brief Creates filter with dynamic window length.
+    //!
+    //! The window is stored in the range from @c begin to @c end. The range
+    //! must outlive the filter.
+    template <typename ContiguousIterator>
+    basic_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
     void clear() noexcept;
     void push(value_type value) noexcept;
 
@@ -49,27 +118,91 @@ public:
     size_type size() const noexcept;
 
 protected:
-    value_type storage[N];
-    circular_span<value_type> window;
+    using sum_type = typename detail::moment_traits<value_type>::sum_type;
+
+    static value_type quantize(value_type) noexcept;
+    bool advance() noexcept;
+    bool aligned() const noexcept;
+    void resync() noexcept;
+    template <std::size_t Power, typename R>
+    R central_sum(R center) const noexcept;
+
+protected:
+    circular_array<storage_type, N> window;
     struct
     {
-        value_type mean = value_type(0);
+        sum_type mean = sum_type(0);
     } sum;
+    struct
+    {
+        // Pushes until the window has been entirely replaced
+        size_type countdown;
+    } member;
 };
 
-template <typename T, std::size_t N>
-class basic_moment<T, N, with::variance>
-    : protected basic_moment<T, N, with::mean>
+template <typename T, std::size_t N, typename Storage>
+class basic_moment<T, N, with::variance, Storage>
+    : protected basic_moment<T, N, with::mean, Storage>
+{
+protected:
+    using super = basic_moment<T, N, with::mean, Storage>;
+
+public:
+    using typename super::value_type;
+    using typename super::storage_type;
+    using typename super::size_type;
+    using result_type = typename detail::moment_traits<value_type>::result_type;
+
+    basic_moment() noexcept;
+    explicit basic_moment(size_type capacity);
+    template <typename ContiguousIterator>
+    basic_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
+    void clear() noexcept;
+    void push(value_type value) noexcept;
+
+    using super::capacity;
+    using super::empty;
+    using super::full;
+    using super::mean;
+    using super::size;
+    result_type variance() const noexcept;
+    result_type unbiased_variance() const noexcept;
+
+protected:
+    using square_type = typename detail::moment_traits<value_type>::square_type;
+
+    void push(value_type, std::true_type) noexcept;
+    void push(value_type, std::false_type) noexcept;
+    result_type normalize(size_type divisor) const noexcept;
+    void resync() noexcept;
+
+protected:
+    struct
+    {
+        // Sum of squared deviations, or sum of squares for integers
+        square_type variance = square_type(0);
+    } sum;
+};
+
+template <typename T, std::size_t N, typename Storage>
+class basic_moment<T, N, with::skewness, Storage>
+    : protected basic_moment<T, N, with::variance, Storage>
 {
-    using super = basic_moment<T, N, with::mean>;
+protected:
+    using super = basic_moment<T, N, with::variance, Storage>;
 
 public:
     using typename super::value_type;
+    using typename super::storage_type;
     using typename super::size_type;
 
     static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
 
     basic_moment() noexcept;
+    explicit basic_moment(size_type capacity);
+    template <typename ContiguousIterator>
+    basic_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
 
     void clear() noexcept;
     void push(value_type value) noexcept;
@@ -79,16 +212,60 @@ public:
     using super::full;
     using super::mean;
     using super::size;
-    value_type variance() const noexcept;
-    value_type unbiased_variance() const noexcept;
+    using super::variance;
+    using super::unbiased_variance;
+    value_type skewness() const noexcept;
+    value_type unbiased_skewness() const noexcept;
 
 protected:
-    value_type delta(value_type, value_type) noexcept;
+    void resync() noexcept;
 
 protected:
     struct
     {
-        value_type variance = value_type(0);
+        value_type skewness = value_type(0);
+    } sum;
+};
+
+template <typename T, std::size_t N, typename Storage>
+class basic_moment<T, N, with::kurtosis, Storage>
+    : protected basic_moment<T, N, with::skewness, Storage>
+{
+protected:
+    using super = basic_moment<T, N, with::skewness, Storage>;
+
+public:
+    using typename super::value_type;
+    using typename super::storage_type;
+    using typename super::size_type;
+
+    basic_moment() noexcept;
+    explicit basic_moment(size_type capacity);
+    template <typename ContiguousIterator>
+    basic_moment(ContiguousIterator begin, ContiguousIterator end) noexcept;
+
+    void clear() noexcept;
+    void push(value_type value) noexcept;
+
+    using super::capacity;
+    using super::empty;
+    using super::full;
+    using super::mean;
+    using super::size;
+    using super::variance;
+    using super::unbiased_variance;
+    using super::skewness;
+    using super::unbiased_skewness;
+    value_type kurtosis() const noexcept;
+    value_type unbiased_kurtosis() const noexcept;
+
+protected:
+    void resync() noexcept;
+
+protected:
+    struct
+    {
+        value_type kurtosis = value_type(0);
     } sum;
 };
 
@@ -98,6 +275,12 @@ using moment = basic_moment<T, N, with::mean>;
 template <typename T, std::size_t N>
 using moment_variance = basic_moment<T, N, with::variance>;
 
+template <typename T, std::size_t N>
+using moment_skewness = basic_moment<T, N, with::skewness>;
+
+template <typename T, std::size_t N>
+using moment_kurtosis = basic_moment<T, N, with::kurtosis>;
+
 } // namespace window
 } // namespace online
 } // namespace trial
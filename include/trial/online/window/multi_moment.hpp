@@ -0,0 +1,140 @@
+#ifndef TRIAL_ONLINE_WINDOW_MULTI_MOMENT_HPP
+#define TRIAL_ONLINE_WINDOW_MULTI_MOMENT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <array>
+#include <type_traits>
+#include <trial/online/with.hpp>
+#include <trial/online/circular_array.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+namespace detail
+{
+
+constexpr std::size_t maximum_of(std::size_t value) noexcept
+{
+    return value;
+}
+
+template <typename... Tail>
+constexpr std::size_t maximum_of(std::size_t first, std::size_t second, Tail... tail) noexcept
+{
+    return maximum_of((first < second) ? second : first, tail...);
+}
+
+} // namespace detail
+
+//! @brief Moments over several sliding windows of the same input.
+//!
+//! The inputs are stored once in a window of the largest length, and each
+//! window length, or horizon, keeps its own sums. A push subtracts the input
+//! that leaves each horizon.
+//!
+//! Horizons are identified by their index in @c N.
+//!
+//! The sums are recalculated exactly from the window every time the largest
+//! window has been entirely replaced.
+
+template <typename T, online::with Moment, std::size_t... N>
+class basic_multi_moment;
+
+template <typename T, std::size_t... N>
+class basic_multi_moment<T, with::mean, N...>
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static_assert(sizeof...(N) > 0, "There must be at least one window length");
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+
+    static constexpr size_type horizon_count = sizeof...(N);
+
+    void clear() noexcept;
+    void push(value_type input) noexcept;
+
+    //! @brief Returns window length of horizon.
+    size_type capacity(size_type horizon) const noexcept;
+
+    //! @brief Returns number of inputs in horizon.
+    size_type size(size_type horizon) const noexcept;
+
+    //! @brief Returns mean of horizon.
+    value_type mean(size_type horizon) const noexcept;
+
+protected:
+    static constexpr size_type max_extent = detail::maximum_of(N...);
+
+    value_type leaving(size_type horizon) const noexcept;
+    bool aligned() const noexcept;
+    void resync() noexcept;
+
+protected:
+    static constexpr size_type extents[horizon_count] = { N... };
+
+    circular_array<value_type, max_extent> window;
+    struct
+    {
+        std::array<value_type, sizeof...(N)> mean;
+    } sum = {};
+};
+
+template <typename T, std::size_t... N>
+class basic_multi_moment<T, with::variance, N...>
+    : protected basic_multi_moment<T, with::mean, N...>
+{
+protected:
+    using super = basic_multi_moment<T, with::mean, N...>;
+
+public:
+    using typename super::value_type;
+    using typename super::size_type;
+    using super::horizon_count;
+
+    void clear() noexcept;
+    void push(value_type input) noexcept;
+
+    using super::capacity;
+    using super::size;
+    using super::mean;
+    value_type variance(size_type horizon) const noexcept;
+    value_type unbiased_variance(size_type horizon) const noexcept;
+
+protected:
+    void resync() noexcept;
+
+protected:
+    struct
+    {
+        std::array<value_type, sizeof...(N)> variance;
+    } sum = {};
+};
+
+template <typename T, std::size_t... N>
+using multi_moment = basic_multi_moment<T, with::mean, N...>;
+
+template <typename T, std::size_t... N>
+using multi_moment_variance = basic_multi_moment<T, with::variance, N...>;
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/multi_moment.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_MULTI_MOMENT_HPP
@@ -0,0 +1,160 @@
+#ifndef TRIAL_ONLINE_WINDOW_QUANTILE_HPP
+#define TRIAL_ONLINE_WINDOW_QUANTILE_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+#include <array>
+#include <vector>
+#include <ratio>
+#include <boost/mp11/list.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <trial/online/detail/type_traits.hpp>
+#include <trial/online/circular_array.hpp>
+#include <trial/online/quantile/psquare.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace detail
+{
+
+//! @brief Returns smallest integer whose square is not less than value.
+constexpr std::size_t ceil_sqrt(std::size_t value,
+                                std::size_t low = 0,
+                                std::size_t high = std::size_t(1) << 32) noexcept
+{
+    return (low >= high)
+        ? low
+        : ((low + (high - low) / 2) * (low + (high - low) / 2) < value)
+        ? ceil_sqrt(value, low + (high - low) / 2 + 1, high)
+        : ceil_sqrt(value, low, low + (high - low) / 2);
+}
+
+} // namespace detail
+
+namespace window
+{
+
+//! @brief Exact quantiles over a sliding window.
+//!
+//! The window contents are kept sorted in about sqrt(N) blocks of sqrt(N)
+//! values. Each push removes the oldest value from, and inserts the new value
+//! into, a single block, so the push is O(sqrt(N)). The blocks have room to
+//! grow to twice their length, and they are rebalanced in place after every
+//! sqrt(N) pushes.
+//!
+//! Quantiles are calculated with linear interpolation between the two
+//! nearest ranks.
+//!
+//! The filter stores about 3N values; N in the window and 2N in the blocks.
+//! With a fixed window length the values are embedded in the filter, which
+//! is trivially copyable, so large fixed windows may not fit on the stack.
+//! With @c dynamic_extent the values are allocated on the heap.
+
+template <typename T, std::size_t N, typename... Quantiles>
+class basic_quantile
+{
+    static_assert(N > 0, "N must be larger than zero");
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+    static_assert((sizeof...(Quantiles) > 0), "There must be at least one quantile");
+
+    using QuantileList = boost::mp11::mp_sort<boost::mp11::mp_list<quantile::minimum_ratio, Quantiles..., quantile::maximum_ratio>, std::ratio_less>;
+    static_assert(boost::mp11::mp_all_of<QuantileList, online::detail::is_ratio>::value, "Quantiles must be ratios");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //! @brief Creates filter with fixed window length.
+    basic_quantile() noexcept;
+
+    //! @brief Creates filter with dynamic window length.
+    explicit basic_quantile(size_type capacity);
+
+    void clear() noexcept;
+    void push(value_type input) noexcept;
+
+    size_type capacity() const noexcept;
+    bool empty() const noexcept;
+    bool full() const noexcept;
+    size_type size() const noexcept;
+
+    //! @brief Returns quantile by ratio.
+
+    template < typename Q = boost::mp11::mp_at_c<QuantileList, 1 + sizeof...(Quantiles) / 2> >
+    value_type value() const noexcept;
+
+    //! @brief Returns quantile by index.
+    //!
+    //! Index zero is the minimum and the last index is the maximum.
+
+    template <std::size_t Index = 1 + sizeof...(Quantiles) / 2>
+    value_type get() const noexcept;
+
+    //! @brief Returns value by rank.
+    //!
+    //! Rank zero is the smallest value in the window.
+    //!
+    //! @pre rank < size()
+
+    value_type order(size_type rank) const noexcept;
+
+protected:
+    value_type interpolate(value_type ratio) const noexcept;
+    value_type* block(size_type) noexcept;
+    const value_type* block(size_type) const noexcept;
+    size_type locate(value_type) const noexcept;
+    void insert(value_type) noexcept;
+    void erase(value_type) noexcept;
+    void rebuild() noexcept;
+
+protected:
+    static constexpr size_type fixed_block_length = online::detail::ceil_sqrt(N);
+    static constexpr size_type fixed_block_count = (N + fixed_block_length - 1) / fixed_block_length;
+
+    // Blocks with twice the block length
+    using values_type = typename std::conditional<N == dynamic_extent,
+                                                  std::vector<value_type>,
+                                                  std::array<value_type, (N == dynamic_extent) ? 1 : 2 * fixed_block_count * fixed_block_length>>::type;
+    using lengths_type = typename std::conditional<N == dynamic_extent,
+                                                   std::vector<size_type>,
+                                                   std::array<size_type, (N == dynamic_extent) ? 1 : fixed_block_count>>::type;
+
+    circular_array<value_type, N> window;
+    values_type values;
+    lengths_type lengths;
+    struct
+    {
+        size_type block_length;
+        size_type block_count;
+        size_type blocks;
+        size_type pending;
+    } member;
+};
+
+// Convenience types
+
+template <typename T, std::size_t N>
+using median = basic_quantile<T, N, quantile::median_ratio>;
+
+template <typename T, std::size_t N>
+using quartile = basic_quantile<T, N, quantile::lower_quartile_ratio, quantile::median_ratio, quantile::upper_quartile_ratio>;
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/quantile.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_QUANTILE_HPP
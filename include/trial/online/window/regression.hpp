@@ -13,7 +13,6 @@
 
 #include <cstddef>
 #include <type_traits>
-#include <trial/online/window/moment.hpp>
 #include <trial/online/window/comoment.hpp>
 
 namespace trial
@@ -35,6 +34,14 @@ public:
     using value_type = T;
     using size_type = std::size_t;
 
+    //! @brief Creates filter with fixed window length.
+    regression() noexcept = default;
+
+    //! @brief Creates filter with dynamic window length.
+    //!
+    //! The window is allocated on the heap.
+    explicit regression(size_type capacity);
+
     void clear() noexcept;
     size_type size() const noexcept;
 
@@ -56,8 +63,18 @@ public:
 
     value_type slope() const noexcept;
 
-private:
-    basic_moment<value_type, Window, with::variance> x_moment;
+protected:
+    value_type x_mean() const noexcept;
+    value_type x_variance() const noexcept;
+    void resync() noexcept;
+
+protected:
+    // The x inputs are shared with the covariance
+    struct
+    {
+        // Sum of squared deviations from the mean of x
+        value_type xx = value_type(0);
+    } sum;
 };
 
 } // namespace window
@@ -0,0 +1,108 @@
+#ifndef TRIAL_ONLINE_WINDOW_ROLLUP_HPP
+#define TRIAL_ONLINE_WINDOW_ROLLUP_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <trial/online/circular_array.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//! @brief Multi-resolution store of mergeable filters.
+//!
+//! Keeps the latest K buckets at each level. Level zero buckets cover one
+//! slice each, and each bucket on level L+1 is the merge of Fanout[L]
+//! consecutive buckets on level L, so coarser levels retain a longer history
+//! with less resolution. For example, with fanouts 60 and 60 and a slice of
+//! one second the levels hold seconds, minutes, and hours.
+//!
+//! Inputs are pushed into the open bucket, and advance() closes it at the end
+//! of each slice. A closed bucket is merged into the open bucket of the next
+//! level, which is closed in turn when it has received Fanout buckets.
+//!
+//! Filter must be default constructible, and support push() and operator+=,
+//! such as the cumulative moments and comoments.
+
+template <typename Filter, std::size_t K, std::size_t... Fanout>
+class rollup
+{
+public:
+    using filter_type = Filter;
+    using size_type = std::size_t;
+
+    static constexpr size_type level_count = sizeof...(Fanout) + 1;
+
+    static_assert(K > 0, "K must be larger than zero");
+    static_assert(K != dynamic_extent, "K must be fixed");
+
+    rollup() noexcept;
+
+    void clear() noexcept;
+
+    //! @brief Appends input to open bucket.
+    template <typename... Args>
+    void push(Args&&... args);
+
+    //! @brief Closes open bucket and starts a new slice.
+    void advance() noexcept;
+
+    //! @brief Returns number of closed slices.
+    std::uint64_t slices() const noexcept;
+
+    //! @brief Returns number of slices covered by each bucket on level.
+    size_type span(size_type level) const noexcept;
+
+    //! @brief Returns number of buckets on level.
+    size_type size(size_type level) const noexcept;
+
+    //! @brief Returns bucket on level by position.
+    //!
+    //! Position zero is the oldest bucket.
+    //!
+    //! @pre position < size(level)
+    const filter_type& at(size_type level, size_type position) const noexcept;
+
+    //! @brief Returns open bucket.
+    const filter_type& current() const noexcept;
+
+    //! @brief Returns filter merged over the latest closed slices.
+    //!
+    //! The range is covered by the coarsest buckets that fit within it. If
+    //! the oldest part of the range is only retained by coarser buckets, the
+    //! range is widened to the boundary of the finest such bucket, and if it
+    //! is not retained at all, the range is truncated.
+    filter_type value(std::uint64_t count) const;
+
+protected:
+    void close(size_type level) noexcept;
+
+protected:
+    std::array<circular_array<filter_type, K>, level_count> buckets;
+    std::array<filter_type, level_count> open;
+    std::array<size_type, level_count> counts;
+    std::array<size_type, level_count> spans;
+    std::uint64_t time;
+};
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/rollup.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_ROLLUP_HPP
@@ -0,0 +1,105 @@
+#ifndef TRIAL_ONLINE_WINDOW_TIMED_COMOMENT_HPP
+#define TRIAL_ONLINE_WINDOW_TIMED_COMOMENT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <chrono>
+#include <type_traits>
+#include <trial/online/with.hpp>
+#include <trial/online/detail/timed_queue.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//! @brief Co-moments over a sliding time window.
+//!
+//! Each input pair is pushed with a timestamp, and pairs are removed once
+//! they are older than the window duration.
+//!
+//! Timestamps must be pushed in non-decreasing order.
+
+template <typename T, online::with Moment, typename Clock = std::chrono::steady_clock>
+class basic_timed_comoment;
+
+template <typename T, typename Clock>
+class basic_timed_comoment<T, with::variance, Clock>
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+
+    //! @brief Creates filter with window duration.
+    explicit basic_timed_comoment(duration window);
+
+    void clear() noexcept;
+
+    //! @brief Appends input pair at given time.
+    //!
+    //! Removes input pairs that are older than the window duration relative
+    //! to @c now.
+    //!
+    //! @pre @c now is not earlier than the previously pushed timestamp.
+    void push(time_point now, value_type first, value_type second);
+
+    //! @brief Removes input pairs that are older than the window duration.
+    void expire(time_point now);
+
+    duration window() const noexcept;
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    value_type variance() const noexcept;
+    value_type unbiased_variance() const noexcept;
+
+protected:
+    struct element_type
+    {
+        time_point time;
+        value_type x;
+        value_type y;
+    };
+
+    value_type cosum() const noexcept;
+    void resync() noexcept;
+
+protected:
+    detail::timed_queue<element_type> queue;
+    struct
+    {
+        duration window;
+        size_type removed;
+    } member;
+    struct
+    {
+        value_type x = value_type(0);
+        value_type y = value_type(0);
+        value_type xy = value_type(0);
+    } sum;
+};
+
+template <typename T, typename Clock = std::chrono::steady_clock>
+using timed_covariance = basic_timed_comoment<T, with::variance, Clock>;
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/timed_comoment.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_TIMED_COMOMENT_HPP
@@ -0,0 +1,151 @@
+#ifndef TRIAL_ONLINE_WINDOW_TIMED_MOMENT_HPP
+#define TRIAL_ONLINE_WINDOW_TIMED_MOMENT_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <chrono>
+#include <type_traits>
+#include <trial/online/with.hpp>
+#include <trial/online/detail/timed_queue.hpp>
+
+namespace trial
+{
+namespace online
+{
+namespace window
+{
+
+//! @brief Moments over a sliding time window.
+//!
+//! Each input is pushed with a timestamp, and inputs are removed once they
+//! are older than the window duration. The number of inputs in the window
+//! therefore varies with the input rate.
+//!
+//! The inputs are stored in a ring that grows and shrinks with the number of
+//! inputs in the window. The sums are updated incrementally, and are
+//! recalculated exactly once as many inputs have been removed as there are
+//! in the window, which is amortized O(1) per input.
+//!
+//! Timestamps must be pushed in non-decreasing order.
+
+template <typename T, online::with Moment, typename Clock = std::chrono::steady_clock>
+class basic_timed_moment;
+
+template <typename T, typename Clock>
+class basic_timed_moment<T, with::mean, Clock>
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    static_assert(std::is_floating_point<T>::value, "T must be a floating-point type");
+
+    //! @brief Creates filter with window duration.
+    explicit basic_timed_moment(duration window);
+
+    void clear() noexcept;
+
+    //! @brief Appends input at given time.
+    //!
+    //! Removes inputs that are older than the window duration relative to
+    //! @c now.
+    //!
+    //! @pre @c now is not earlier than the previously pushed timestamp.
+    void push(time_point now, value_type input);
+
+    //! @brief Removes inputs that are older than the window duration.
+    void expire(time_point now);
+
+    duration window() const noexcept;
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    value_type mean() const noexcept;
+
+protected:
+    struct element_type
+    {
+        time_point time;
+        value_type value;
+    };
+
+    bool expired(time_point now) const noexcept;
+    void add(time_point, value_type);
+    void remove();
+    bool unsynced() const noexcept;
+    void resync() noexcept;
+
+protected:
+    detail::timed_queue<element_type> queue;
+    struct
+    {
+        duration window;
+        size_type removed;
+    } member;
+    struct
+    {
+        value_type mean = value_type(0);
+    } sum;
+};
+
+template <typename T, typename Clock>
+class basic_timed_moment<T, with::variance, Clock>
+    : protected basic_timed_moment<T, with::mean, Clock>
+{
+protected:
+    using super = basic_timed_moment<T, with::mean, Clock>;
+
+public:
+    using typename super::value_type;
+    using typename super::size_type;
+    using typename super::time_point;
+    using typename super::duration;
+
+    explicit basic_timed_moment(duration window);
+
+    void clear() noexcept;
+    void push(time_point now, value_type input);
+    void expire(time_point now);
+
+    using super::window;
+    using super::empty;
+    using super::size;
+    using super::mean;
+    value_type variance() const noexcept;
+    value_type unbiased_variance() const noexcept;
+
+protected:
+    void add(time_point, value_type);
+    void remove();
+    void resync() noexcept;
+
+protected:
+    struct
+    {
+        value_type variance = value_type(0);
+    } sum;
+};
+
+template <typename T, typename Clock = std::chrono::steady_clock>
+using timed_moment = basic_timed_moment<T, with::mean, Clock>;
+
+template <typename T, typename Clock = std::chrono::steady_clock>
+using timed_moment_variance = basic_timed_moment<T, with::variance, Clock>;
+
+} // namespace window
+} // namespace online
+} // namespace trial
+
+#include <trial/online/window/detail/timed_moment.ipp>
+
+#endif // TRIAL_ONLINE_WINDOW_TIMED_MOMENT_HPP
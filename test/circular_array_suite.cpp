@@ -0,0 +1,284 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/circular_array.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace fixed_suite
+{
+
+static_assert(std::is_trivially_copyable<circular_array<int, 4>>::value, "circular_array must be trivially copyable");
+
+void test_ctor()
+{
+    circular_array<int, 4> array;
+    TRIAL_ONLINE_TEST(array.empty());
+    TRIAL_ONLINE_TEST(!array.full());
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(array.capacity(), 4);
+}
+
+void test_push_front()
+{
+    circular_array<int, 4> array;
+    array.push_front(1);
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 1);
+    array.push_front(2);
+    array.push_front(3);
+    array.push_front(4);
+    TRIAL_ONLINE_TEST(array.full());
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 1);
+    array.push_front(5);
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 5);
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 2);
+}
+
+void test_push_back()
+{
+    circular_array<int, 4> array;
+    array.push_back(1);
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 1);
+    array.push_back(2);
+    array.push_back(3);
+    array.push_back(4);
+    TRIAL_ONLINE_TEST(array.full());
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 4);
+    array.push_back(5);
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 5);
+    {
+        std::vector<int> expect = { 2, 3, 4, 5 };
+        TRIAL_ONLINE_TEST_ALL_EQUAL(array.begin(), array.end(),
+                                    expect.begin(), expect.end());
+    }
+}
+
+void test_pop()
+{
+    circular_array<int, 4> array;
+    array = { 1, 2, 3, 4, 5 };
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 4);
+    array.pop_front();
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 3);
+    array.pop_back();
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 2);
+}
+
+void test_copy()
+{
+    circular_array<int, 4> array;
+    array = { 1, 2, 3, 4, 5 };
+    circular_array<int, 4> copy(array);
+    array.push_back(6);
+    {
+        std::vector<int> expect = { 2, 3, 4, 5 };
+        TRIAL_ONLINE_TEST_ALL_EQUAL(copy.begin(), copy.end(),
+                                    expect.begin(), expect.end());
+    }
+    {
+        std::vector<int> expect = { 3, 4, 5, 6 };
+        TRIAL_ONLINE_TEST_ALL_EQUAL(array.begin(), array.end(),
+                                    expect.begin(), expect.end());
+    }
+}
+
+void test_memcpy()
+{
+    circular_array<int, 4> array;
+    array = { 1, 2, 3, 4, 5 };
+    circular_array<int, 4> copy;
+    std::memcpy(&copy, &array, sizeof(array));
+    array.clear();
+    {
+        std::vector<int> expect = { 2, 3, 4, 5 };
+        TRIAL_ONLINE_TEST_ALL_EQUAL(copy.begin(), copy.end(),
+                                    expect.begin(), expect.end());
+    }
+}
+
+void test_vector()
+{
+    std::vector<circular_array<int, 2>> arrays(2);
+    arrays[0].push_back(1);
+    arrays[1].push_back(2);
+    arrays.resize(1024); // Relocates elements
+    TRIAL_ONLINE_TEST_EQUAL(arrays[0].back(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(arrays[1].back(), 2);
+}
+
+void test_iterator()
+{
+    circular_array<int, 4> array;
+    array = { 1, 2, 3 };
+    *array.begin() = 11;
+    {
+        std::vector<int> expect = { 11, 2, 3 };
+        TRIAL_ONLINE_TEST_ALL_EQUAL(array.cbegin(), array.cend(),
+                                    expect.begin(), expect.end());
+    }
+    TRIAL_ONLINE_TEST_EQUAL(std::accumulate(array.begin(), array.end(), 0), 16);
+}
+
+void test_push_back_range()
+{
+    for (std::size_t offset = 0; offset < 10; ++offset)
+    {
+        for (std::size_t length = 0; length < 10; ++length)
+        {
+            circular_array<int, 4> array;
+            circular_array<int, 4> expect;
+            for (std::size_t k = 0; k < offset; ++k)
+            {
+                array.push_back(int(k));
+                expect.push_back(int(k));
+            }
+            std::vector<int> input(length);
+            std::iota(input.begin(), input.end(), 100);
+            array.push_back(input.begin(), input.end());
+            for (auto value : input)
+            {
+                expect.push_back(value);
+            }
+            TRIAL_ONLINE_TEST_EQUAL(array.size(), expect.size());
+            TRIAL_ONLINE_TEST_ALL_EQUAL(array.begin(), array.end(),
+                                        expect.begin(), expect.end());
+            auto one = array.array_one();
+            auto two = array.array_two();
+            std::vector<int> result(one.first, one.first + one.second);
+            result.insert(result.end(), two.first, two.first + two.second);
+            TRIAL_ONLINE_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                        expect.begin(), expect.end());
+        }
+    }
+}
+
+void test_random_access()
+{
+    circular_array<int, 5> array;
+    array = { 0, 0, 5, 1, 4, 3, 2 };
+    TRIAL_ONLINE_TEST_EQUAL(array[0], 5);
+    TRIAL_ONLINE_TEST_EQUAL(array[4], 2);
+    TRIAL_ONLINE_TEST_EQUAL(array.end() - array.begin(), 5);
+    auto middle = array.begin() + 2;
+    std::nth_element(array.begin(), middle, array.end());
+    TRIAL_ONLINE_TEST_EQUAL(*middle, 3);
+    std::sort(array.begin(), array.end());
+    std::vector<int> expect = { 1, 2, 3, 4, 5 };
+    TRIAL_ONLINE_TEST_ALL_EQUAL(array.begin(), array.end(),
+                                expect.begin(), expect.end());
+    TRIAL_ONLINE_TEST(std::binary_search(array.cbegin(), array.cend(), 4));
+}
+
+void run()
+{
+    test_ctor();
+    test_random_access();
+    test_push_front();
+    test_push_back();
+    test_push_back_range();
+    test_pop();
+    test_copy();
+    test_memcpy();
+    test_vector();
+    test_iterator();
+}
+
+} // namespace fixed_suite
+
+//-----------------------------------------------------------------------------
+
+namespace dynamic_suite
+{
+
+void test_ctor()
+{
+    circular_array<int> array(4);
+    TRIAL_ONLINE_TEST(array.empty());
+    TRIAL_ONLINE_TEST_EQUAL(array.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(array.capacity(), 4);
+}
+
+void test_push_back()
+{
+    circular_array<int> array(3);
+    array = { 1, 2, 3, 4 };
+    TRIAL_ONLINE_TEST(array.full());
+    TRIAL_ONLINE_TEST_EQUAL(array.front(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(array.back(), 4);
+}
+
+void test_copy()
+{
+    circular_array<int> array(3);
+    array = { 1, 2, 3 };
+    circular_array<int> copy(array);
+    array.push_back(4);
+    {
+        std::vector<int> expect = { 1, 2, 3 };
+        TRIAL_ONLINE_TEST_ALL_EQUAL(copy.begin(), copy.end(),
+                                    expect.begin(), expect.end());
+    }
+    copy = array;
+    {
+        std::vector<int> expect = { 2, 3, 4 };
+        TRIAL_ONLINE_TEST_ALL_EQUAL(copy.begin(), copy.end(),
+                                    expect.begin(), expect.end());
+    }
+}
+
+void test_external_storage()
+{
+    int storage[3];
+    circular_array<int> array(storage, storage + 3);
+    TRIAL_ONLINE_TEST_EQUAL(array.capacity(), 3);
+    array = { 1, 2, 3, 4 };
+    TRIAL_ONLINE_TEST_EQUAL(storage[0], 4);
+    TRIAL_ONLINE_TEST_EQUAL(storage[1], 2);
+    TRIAL_ONLINE_TEST_EQUAL(storage[2], 3);
+}
+
+void run()
+{
+    test_ctor();
+    test_push_back();
+    test_copy();
+    test_external_storage();
+}
+
+} // namespace dynamic_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    fixed_suite::run();
+    dynamic_suite::run();
+
+    return boost::report_errors();
+}
@@ -1121,6 +1121,209 @@ void run()
 
 } // namespace std_numeric_suite
 
+//-----------------------------------------------------------------------------
+
+namespace segment_suite
+{
+
+void test_push_back_range()
+{
+    // Compare against element-wise insertion for all offsets and lengths
+    for (std::size_t offset = 0; offset < 10; ++offset)
+    {
+        for (std::size_t length = 0; length < 10; ++length)
+        {
+            std::array<int, 4> array;
+            circular_span<int> span(array.begin(), array.end());
+            std::array<int, 4> expect_array;
+            circular_span<int> expect(expect_array.begin(), expect_array.end());
+            for (std::size_t k = 0; k < offset; ++k)
+            {
+                span.push_back(int(k));
+                expect.push_back(int(k));
+            }
+            std::vector<int> input(length);
+            std::iota(input.begin(), input.end(), 100);
+            span.push_back(input.begin(), input.end());
+            for (auto value : input)
+            {
+                expect.push_back(value);
+            }
+            TRIAL_ONLINE_TEST_EQUAL(span.size(), expect.size());
+            TRIAL_ONLINE_TEST_ALL_EQUAL(span.begin(), span.end(),
+                                        expect.begin(), expect.end());
+            span.push_back(42);
+            expect.push_back(42);
+            TRIAL_ONLINE_TEST_ALL_EQUAL(span.begin(), span.end(),
+                                        expect.begin(), expect.end());
+        }
+    }
+}
+
+void test_array_empty()
+{
+    std::array<int, 4> array;
+    circular_span<int> span(array.begin(), array.end());
+    TRIAL_ONLINE_TEST_EQUAL(span.array_one().second, 0);
+    TRIAL_ONLINE_TEST_EQUAL(span.array_two().second, 0);
+}
+
+void test_array_partial()
+{
+    std::array<int, 4> array;
+    circular_span<int> span(array.begin(), array.end());
+    span = { 1, 2, 3 };
+    TRIAL_ONLINE_TEST(span.array_one().first == array.data());
+    TRIAL_ONLINE_TEST_EQUAL(span.array_one().second, 3);
+    TRIAL_ONLINE_TEST_EQUAL(span.array_two().second, 0);
+}
+
+void test_array_wrapped()
+{
+    std::array<int, 4> array;
+    circular_span<int> span(array.begin(), array.end());
+    span = { 1, 2, 3, 4, 5, 6 };
+    const auto& cspan = span;
+    auto one = cspan.array_one();
+    auto two = cspan.array_two();
+    TRIAL_ONLINE_TEST_EQUAL(one.second, 2);
+    TRIAL_ONLINE_TEST_EQUAL(two.second, 2);
+    std::vector<int> result(one.first, one.first + one.second);
+    result.insert(result.end(), two.first, two.first + two.second);
+    std::vector<int> expect = { 3, 4, 5, 6 };
+    TRIAL_ONLINE_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                expect.begin(), expect.end());
+}
+
+void test_array_all()
+{
+    // Segments cover the elements in order for all offsets and sizes
+    for (std::size_t offset = 0; offset < 10; ++offset)
+    {
+        for (std::size_t length = 0; length <= 5; ++length)
+        {
+            std::array<int, 5> array;
+            circular_span<int> span(array.begin(), array.end());
+            for (std::size_t k = 0; k < offset; ++k)
+                span.push_back(-1);
+            span.clear();
+            for (std::size_t k = 0; k < offset + length; ++k)
+                span.push_back(int(k));
+            while (span.size() > length)
+                span.pop_front();
+            auto one = span.array_one();
+            auto two = span.array_two();
+            TRIAL_ONLINE_TEST_EQUAL(one.second + two.second, span.size());
+            std::vector<int> result(one.first, one.first + one.second);
+            result.insert(result.end(), two.first, two.first + two.second);
+            TRIAL_ONLINE_TEST_ALL_EQUAL(result.begin(), result.end(),
+                                        span.begin(), span.end());
+        }
+    }
+}
+
+void run()
+{
+    test_push_back_range();
+    test_array_empty();
+    test_array_partial();
+    test_array_wrapped();
+    test_array_all();
+}
+
+} // namespace segment_suite
+
+//-----------------------------------------------------------------------------
+
+namespace random_access_suite
+{
+
+void test_subscript()
+{
+    std::array<int, 4> array;
+    circular_span<int> span(array.begin(), array.end());
+    span = { 1, 2, 3, 4, 5, 6 };
+    TRIAL_ONLINE_TEST_EQUAL(span[0], 3);
+    TRIAL_ONLINE_TEST_EQUAL(span[1], 4);
+    TRIAL_ONLINE_TEST_EQUAL(span[2], 5);
+    TRIAL_ONLINE_TEST_EQUAL(span[3], 6);
+    span[1] = 44;
+    TRIAL_ONLINE_TEST_EQUAL(span[1], 44);
+}
+
+void test_arithmetic()
+{
+    std::array<int, 4> array;
+    circular_span<int> span(array.begin(), array.end());
+    span = { 1, 2, 3, 4, 5, 6 };
+    TRIAL_ONLINE_TEST_EQUAL(span.end() - span.begin(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(span.begin() - span.end(), -4);
+    TRIAL_ONLINE_TEST_EQUAL(std::distance(span.begin(), span.end()), 4);
+    TRIAL_ONLINE_TEST_EQUAL(*(span.begin() + 2), 5);
+    TRIAL_ONLINE_TEST_EQUAL(*(2 + span.begin()), 5);
+    TRIAL_ONLINE_TEST_EQUAL(*(span.end() - 1), 6);
+    TRIAL_ONLINE_TEST_EQUAL(span.begin()[3], 6);
+    TRIAL_ONLINE_TEST(span.begin() + 4 == span.end());
+    auto it = span.end();
+    --it;
+    TRIAL_ONLINE_TEST_EQUAL(*it, 6);
+    it -= 3;
+    TRIAL_ONLINE_TEST(it == span.begin());
+}
+
+void test_ordering()
+{
+    std::array<int, 4> array;
+    circular_span<int> span(array.begin(), array.end());
+    span = { 1, 2, 3, 4, 5, 6 };
+    TRIAL_ONLINE_TEST(span.begin() < span.end());
+    TRIAL_ONLINE_TEST(span.begin() <= span.begin());
+    TRIAL_ONLINE_TEST(span.end() > span.begin() + 3);
+    TRIAL_ONLINE_TEST(span.end() >= span.end());
+    TRIAL_ONLINE_TEST(!(span.end() < span.begin()));
+}
+
+void test_nth_element()
+{
+    for (std::size_t offset = 0; offset < 7; ++offset)
+    {
+        std::array<int, 7> array;
+        circular_span<int> span(array.begin(), array.end());
+        for (std::size_t k = 0; k < offset; ++k)
+            span.push_back(0);
+        for (auto value : { 5, 1, 7, 3, 6, 2, 4 })
+            span.push_back(value);
+        TRIAL_ONLINE_TEST_EQUAL(span.end() - span.begin(), 7);
+        auto middle = span.begin() + 3;
+        std::nth_element(span.begin(), middle, span.end());
+        TRIAL_ONLINE_TEST_EQUAL(*middle, 4);
+    }
+}
+
+void test_sort()
+{
+    std::array<int, 5> array;
+    circular_span<int> span(array.begin(), array.end());
+    span = { 9, 9, 5, 1, 4, 3, 2 };
+    std::sort(span.begin(), span.end());
+    std::vector<int> expect = { 1, 2, 3, 4, 5 };
+    TRIAL_ONLINE_TEST_ALL_EQUAL(span.begin(), span.end(),
+                                expect.begin(), expect.end());
+    TRIAL_ONLINE_TEST_EQUAL(*std::lower_bound(span.begin(), span.end(), 3), 3);
+    TRIAL_ONLINE_TEST_EQUAL(std::upper_bound(span.begin(), span.end(), 3) - span.begin(), 3);
+}
+
+void run()
+{
+    test_subscript();
+    test_arithmetic();
+    test_ordering();
+    test_nth_element();
+    test_sort();
+}
+
+} // namespace random_access_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -1135,6 +1338,8 @@ int main()
     window_size_suite::run();
     std_algorithm_suite::run();
     std_numeric_suite::run();
+    segment_suite::run();
+    random_access_suite::run();
 
     return boost::report_errors();
 }
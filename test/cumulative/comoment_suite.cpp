@@ -200,6 +200,44 @@ void test_clear()
     TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
 }
 
+void test_merge()
+{
+    const double tolerance = 1e-9;
+    const double x[] = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5 };
+    const double y[] = { 4.0, 1.0, 7.0, 2.0, 1e2, 3.0, 9.0, 5e2, 0.0 };
+    cumulative::covariance<double> filter;
+    cumulative::covariance<double> lhs;
+    cumulative::covariance<double> rhs;
+    for (int i = 0; i < 9; ++i)
+    {
+        filter.push(x[i], y[i]);
+        if (i < 4)
+            lhs.push(x[i], y[i]);
+        else
+            rhs.push(x[i], y[i]);
+    }
+    lhs += rhs;
+    TRIAL_ONLINE_TEST_EQUAL(lhs.size(), filter.size());
+    TRIAL_ONLINE_TEST_CLOSE(lhs.variance(), filter.variance(), tolerance);
+    TRIAL_ONLINE_TEST_CLOSE(lhs.unbiased_variance(), filter.unbiased_variance(), tolerance);
+}
+
+void test_merge_empty()
+{
+    cumulative::covariance<double> filter;
+    cumulative::covariance<double> other;
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    other.push(1.0, 2.0);
+    other.push(2.0, 4.0);
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), other.variance());
+    filter += cumulative::covariance<double>();
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), other.variance());
+}
+
 void run()
 {
     test_ctor();
@@ -212,6 +250,8 @@ void run()
     test_down_up_by_one();
     test_exponential_increase();
     test_clear();
+    test_merge();
+    test_merge_empty();
 }
 
 } // namespace covariance_double_suite
@@ -50,10 +50,33 @@ void test_hinton()
     TRIAL_ONLINE_TEST_CLOSE(filter.value(), 0.72071, tolerance);
 }
 
+void test_merge()
+{
+    const double tolerance = 1e-9;
+    const double x[] = { 40.0, 43.0, 18.0, 10.0, 25.0, 33.0, 27.0, 17.0, 30.0, 47.0 };
+    const double y[] = { 58.0, 73.0, 56.0, 47.0, 58.0, 54.0, 45.0, 32.0, 68.0, 69.0 };
+    cumulative::correlation<double> filter;
+    cumulative::correlation<double> lhs;
+    cumulative::correlation<double> rhs;
+    for (int i = 0; i < 10; ++i)
+    {
+        filter.push(x[i], y[i]);
+        if (i < 3)
+            lhs.push(x[i], y[i]);
+        else
+            rhs.push(x[i], y[i]);
+    }
+    lhs += rhs;
+    TRIAL_ONLINE_TEST_EQUAL(lhs.size(), filter.size());
+    TRIAL_ONLINE_TEST_CLOSE(lhs.value(), filter.value(), tolerance);
+    TRIAL_ONLINE_TEST_CLOSE(lhs.value(), 0.72071, 1e-5);
+}
+
 void run()
 {
     test_empty();
     test_hinton();
+    test_merge();
 }
 
 } // namespace double_suite
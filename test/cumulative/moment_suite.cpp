@@ -8,6 +8,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
+#include <algorithm>
+#include <vector>
 #include <trial/online/detail/lightweight_test.hpp>
 #include <trial/online/detail/functional.hpp>
 #include <trial/online/cumulative/moment.hpp>
@@ -112,6 +115,63 @@ void test_exponential_increase()
     TRIAL_ONLINE_TEST_WITH(filter.unbiased_mean(), 1.23456e8, tolerance);
 }
 
+void test_merge()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    cumulative::moment<double> filter;
+    cumulative::moment<double> lhs;
+    cumulative::moment<double> rhs;
+    for (int i = 0; i < 5; ++i)
+    {
+        filter.push(1e0 + i);
+        lhs.push(1e0 + i);
+    }
+    for (int i = 0; i < 7; ++i)
+    {
+        filter.push(1e2 * i);
+        rhs.push(1e2 * i);
+    }
+    lhs += rhs;
+    TRIAL_ONLINE_TEST_EQUAL(lhs.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(lhs.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.unbiased_mean(), filter.unbiased_mean(), tolerance);
+}
+
+void test_merge_empty()
+{
+    cumulative::moment<double> filter;
+    cumulative::moment<double> other;
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    other.push(2.0);
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    filter += cumulative::moment<double>();
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+}
+
+void test_push_range()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    std::vector<double> data = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0 };
+    cumulative::moment<double> filter;
+    for (auto value : data)
+    {
+        filter.push(value);
+    }
+    cumulative::moment<double> block;
+    block.push(data.begin(), data.begin());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 0);
+    block.push(data.begin(), data.begin() + 3);
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 3);
+    block.push(data.begin() + 3, data.end());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(block.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.unbiased_mean(), filter.unbiased_mean(), tolerance);
+}
+
 void run()
 {
     test_ctor();
@@ -119,6 +179,9 @@ void run()
     test_linear_increase();
     test_linear_decrease();
     test_exponential_increase();
+    test_merge();
+    test_merge_empty();
+    test_push_range();
 }
 
 } // namespace mean_double_suite
@@ -162,11 +225,88 @@ void test_linear_increase()
     TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 3);
 }
 
+void test_merge()
+{
+    cumulative::moment<int> filter;
+    filter.push(1);
+    filter.push(3);
+    filter.push(5);
+    cumulative::moment<int> other;
+    other.push(7);
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 4);
+}
+
+void test_merge_large()
+{
+    cumulative::moment<int> filter;
+    filter.push(0);
+    cumulative::moment<int> other;
+    for (int k = 0; k < 5000; ++k)
+    {
+        other.push(1000000);
+    }
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 5001);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 999800);
+}
+
+void test_merge_small_type()
+{
+    // Combined count does not fit in the value type
+    cumulative::moment<std::int8_t> filter;
+    cumulative::moment<std::int8_t> other;
+    for (int k = 0; k < 128; ++k)
+    {
+        filter.push(10);
+        other.push(30);
+    }
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 256);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 20);
+}
+
+void test_push_range()
+{
+    cumulative::moment<int> filter;
+    std::vector<int> data = { 1, 3, 5, 7 };
+    filter.push(data.begin(), data.end());
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 4);
+}
+
+void test_push_range_overflow()
+{
+    cumulative::moment<std::int8_t> filter;
+    std::vector<std::int8_t> data = { 100, 110, 120, 110 };
+    filter.push(data.begin(), data.end());
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(int(filter.mean()), 110);
+}
+
+void test_push_range_nonempty()
+{
+    // Range is merged into a filter that already holds data
+    cumulative::moment<int> filter;
+    filter.push(0);
+    std::vector<int> data(5000, 1000000);
+    filter.push(data.begin(), data.end());
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 5001);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 999800);
+}
+
 void run()
 {
     test_ctor();
     test_same();
     test_linear_increase();
+    test_merge();
+    test_merge_large();
+    test_merge_small_type();
+    test_push_range();
+    test_push_range_overflow();
+    test_push_range_nonempty();
 }
 
 } // namespace mean_int_suite
@@ -291,18 +431,122 @@ void test_exponential_increase()
     TRIAL_ONLINE_TEST_WITH(filter.unbiased_variance(), 9.8516e16, tolerance);
 }
 
+void test_merge()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    cumulative::moment_variance<double> filter;
+    cumulative::moment_variance<double> lhs;
+    cumulative::moment_variance<double> rhs;
+    const double data[] = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0 };
+    for (int i = 0; i < 4; ++i)
+    {
+        filter.push(data[i]);
+        lhs.push(data[i]);
+    }
+    for (int i = 4; i < 11; ++i)
+    {
+        filter.push(data[i]);
+        rhs.push(data[i]);
+    }
+    lhs += rhs;
+    TRIAL_ONLINE_TEST_EQUAL(lhs.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(lhs.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.variance(), filter.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.unbiased_variance(), filter.unbiased_variance(), tolerance);
+}
+
+void test_merge_partitions()
+{
+    // Merging in any partitioning yields the same result
+    const auto tolerance = detail::close_to<double>(1e-5);
+    const double data[] = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0, 3.0 };
+    cumulative::moment_variance<double> filter;
+    for (auto value : data)
+    {
+        filter.push(value);
+    }
+    for (int width = 1; width < 12; ++width)
+    {
+        cumulative::moment_variance<double> merged;
+        for (int first = 0; first < 12; first += width)
+        {
+            cumulative::moment_variance<double> partition;
+            for (int i = first; i < std::min(first + width, 12); ++i)
+            {
+                partition.push(data[i]);
+            }
+            merged += partition;
+        }
+        TRIAL_ONLINE_TEST_EQUAL(merged.size(), filter.size());
+        TRIAL_ONLINE_TEST_WITH(merged.mean(), filter.mean(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.variance(), filter.variance(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.unbiased_variance(), filter.unbiased_variance(), tolerance);
+    }
+}
+
+void test_push_range()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    std::vector<double> data = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0 };
+    cumulative::moment_variance<double> filter;
+    for (auto value : data)
+    {
+        filter.push(value);
+    }
+    cumulative::moment_variance<double> block;
+    block.push(data.begin(), data.begin());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 0);
+    block.push(data.begin(), data.begin() + 3);
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 3);
+    block.push(data.begin() + 3, data.end());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(block.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.variance(), filter.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.unbiased_variance(), filter.unbiased_variance(), tolerance);
+}
+
 void run()
 {
     test_ctor();
     test_same();
     test_linear_increase();
     test_exponential_increase();
+    test_merge();
+    test_merge_partitions();
+    test_push_range();
 }
 
 } // namespace variance_double_suite
 
 //-----------------------------------------------------------------------------
 
+namespace variance_int_suite
+{
+
+void test_merge()
+{
+    cumulative::moment_variance<int> filter;
+    cumulative::moment_variance<int> other;
+    for (int k = 0; k < 5000; ++k)
+    {
+        filter.push(0);
+        other.push(20);
+    }
+    filter += other;
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 10000);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 10);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 100);
+}
+
+void run()
+{
+    test_merge();
+}
+
+} // namespace variance_int_suite
+
+//-----------------------------------------------------------------------------
+
 namespace skewness_double_suite
 {
 
@@ -445,6 +689,99 @@ void test_left_skew()
     TRIAL_ONLINE_TEST_WITH(filter.unbiased_skewness(), 1.60758, tolerance);
 }
 
+void test_negative_skew()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    cumulative::moment_skewness<double> filter;
+    filter.push(-1.0);
+    filter.push(-2.0);
+    filter.push(-5.0);
+    TRIAL_ONLINE_TEST_WITH(filter.skewness(), -0.52800, tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.unbiased_skewness(), -1.29334, tolerance);
+    filter.push(-15.0);
+    TRIAL_ONLINE_TEST_WITH(filter.mean(), -5.75, tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.variance(), 30.6875, tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.skewness(), -0.92814, tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.unbiased_skewness(), -1.60758, tolerance);
+}
+
+void test_merge()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    cumulative::moment_skewness<double> filter;
+    cumulative::moment_skewness<double> lhs;
+    cumulative::moment_skewness<double> rhs;
+    const double data[] = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0 };
+    for (int i = 0; i < 4; ++i)
+    {
+        filter.push(data[i]);
+        lhs.push(data[i]);
+    }
+    for (int i = 4; i < 11; ++i)
+    {
+        filter.push(data[i]);
+        rhs.push(data[i]);
+    }
+    lhs += rhs;
+    TRIAL_ONLINE_TEST_EQUAL(lhs.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(lhs.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.variance(), filter.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.skewness(), filter.skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.unbiased_skewness(), filter.unbiased_skewness(), tolerance);
+}
+
+void test_merge_partitions()
+{
+    // Merging in any partitioning yields the same result
+    const auto tolerance = detail::close_to<double>(1e-5);
+    const double data[] = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0, 3.0 };
+    cumulative::moment_skewness<double> filter;
+    for (auto value : data)
+    {
+        filter.push(value);
+    }
+    for (int width = 1; width < 12; ++width)
+    {
+        cumulative::moment_skewness<double> merged;
+        for (int first = 0; first < 12; first += width)
+        {
+            cumulative::moment_skewness<double> partition;
+            for (int i = first; i < std::min(first + width, 12); ++i)
+            {
+                partition.push(data[i]);
+            }
+            merged += partition;
+        }
+        TRIAL_ONLINE_TEST_EQUAL(merged.size(), filter.size());
+        TRIAL_ONLINE_TEST_WITH(merged.mean(), filter.mean(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.variance(), filter.variance(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.skewness(), filter.skewness(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.unbiased_skewness(), filter.unbiased_skewness(), tolerance);
+    }
+}
+
+void test_push_range()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    std::vector<double> data = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0 };
+    cumulative::moment_skewness<double> filter;
+    for (auto value : data)
+    {
+        filter.push(value);
+    }
+    cumulative::moment_skewness<double> block;
+    block.push(data.begin(), data.begin());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 0);
+    block.push(data.begin(), data.begin() + 3);
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 3);
+    block.push(data.begin() + 3, data.end());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(block.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.variance(), filter.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.skewness(), filter.skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.unbiased_skewness(), filter.unbiased_skewness(), tolerance);
+}
+
 void run()
 {
     test_ctor();
@@ -452,6 +789,10 @@ void run()
     test_linear_increase();
     test_exponential_increase();
     test_left_skew();
+    test_negative_skew();
+    test_merge();
+    test_merge_partitions();
+    test_push_range();
 }
 
 } // namespace skewness_double_suite
@@ -622,6 +963,89 @@ void test_left_skew()
     TRIAL_ONLINE_TEST_WITH(filter.unbiased_kurtosis(), 5.48416, tolerance);
 }
 
+void test_merge()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    cumulative::moment_kurtosis<double> filter;
+    cumulative::moment_kurtosis<double> lhs;
+    cumulative::moment_kurtosis<double> rhs;
+    const double data[] = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0 };
+    for (int i = 0; i < 4; ++i)
+    {
+        filter.push(data[i]);
+        lhs.push(data[i]);
+    }
+    for (int i = 4; i < 11; ++i)
+    {
+        filter.push(data[i]);
+        rhs.push(data[i]);
+    }
+    lhs += rhs;
+    TRIAL_ONLINE_TEST_EQUAL(lhs.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(lhs.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.variance(), filter.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.skewness(), filter.skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.unbiased_skewness(), filter.unbiased_skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.kurtosis(), filter.kurtosis(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(lhs.unbiased_kurtosis(), filter.unbiased_kurtosis(), tolerance);
+}
+
+void test_merge_partitions()
+{
+    // Merging in any partitioning yields the same result
+    const auto tolerance = detail::close_to<double>(1e-5);
+    const double data[] = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0, 3.0 };
+    cumulative::moment_kurtosis<double> filter;
+    for (auto value : data)
+    {
+        filter.push(value);
+    }
+    for (int width = 1; width < 12; ++width)
+    {
+        cumulative::moment_kurtosis<double> merged;
+        for (int first = 0; first < 12; first += width)
+        {
+            cumulative::moment_kurtosis<double> partition;
+            for (int i = first; i < std::min(first + width, 12); ++i)
+            {
+                partition.push(data[i]);
+            }
+            merged += partition;
+        }
+        TRIAL_ONLINE_TEST_EQUAL(merged.size(), filter.size());
+        TRIAL_ONLINE_TEST_WITH(merged.mean(), filter.mean(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.variance(), filter.variance(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.skewness(), filter.skewness(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.unbiased_skewness(), filter.unbiased_skewness(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.kurtosis(), filter.kurtosis(), tolerance);
+        TRIAL_ONLINE_TEST_WITH(merged.unbiased_kurtosis(), filter.unbiased_kurtosis(), tolerance);
+    }
+}
+
+void test_push_range()
+{
+    const auto tolerance = detail::close_to<double>(1e-5);
+    std::vector<double> data = { 1.0, 2.0, 5.0, 15.0, 1e3, 4.0, 7.0, 1e2, 0.5, 8.0, 11.0 };
+    cumulative::moment_kurtosis<double> filter;
+    for (auto value : data)
+    {
+        filter.push(value);
+    }
+    cumulative::moment_kurtosis<double> block;
+    block.push(data.begin(), data.begin());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 0);
+    block.push(data.begin(), data.begin() + 3);
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), 3);
+    block.push(data.begin() + 3, data.end());
+    TRIAL_ONLINE_TEST_EQUAL(block.size(), filter.size());
+    TRIAL_ONLINE_TEST_WITH(block.mean(), filter.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.variance(), filter.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.skewness(), filter.skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.unbiased_skewness(), filter.unbiased_skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.kurtosis(), filter.kurtosis(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(block.unbiased_kurtosis(), filter.unbiased_kurtosis(), tolerance);
+}
+
 void run()
 {
     test_ctor();
@@ -629,6 +1053,9 @@ void run()
     test_linear_increase();
     test_exponential_increase();
     test_left_skew();
+    test_merge();
+    test_merge_partitions();
+    test_push_range();
 }
 
 } // namespace kurtosis_double_suite
@@ -642,6 +1069,7 @@ int main()
     mean_double_suite::run();
     mean_int_suite::run();
     variance_double_suite::run();
+    variance_int_suite::run();
     skewness_double_suite::run();
     kurtosis_double_suite::run();
 
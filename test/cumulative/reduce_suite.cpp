@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <vector>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/detail/functional.hpp>
+#include <trial/online/cumulative/moment.hpp>
+#include <trial/online/cumulative/comoment.hpp>
+#include <trial/online/cumulative/correlation.hpp>
+#include <trial/online/cumulative/regression.hpp>
+#include <trial/online/cumulative/reduce.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace moment_double_suite
+{
+
+std::vector<double> dataset(std::size_t size)
+{
+    std::vector<double> result;
+    result.reserve(size);
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        result.push_back(double(k % 17) * double(k % 5) + 1e-3 * double(k));
+    }
+    return result;
+}
+
+void test_empty()
+{
+    std::vector<double> data;
+    auto filter = cumulative::reduce<cumulative::moment_variance<double>>(std::launch::deferred, data.begin(), data.end(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+}
+
+void test_deferred()
+{
+    const auto tolerance = detail::close_to<double>(1e-9);
+    auto data = dataset(1000);
+    cumulative::moment_kurtosis<double> expect;
+    for (auto value : data)
+    {
+        expect.push(value);
+    }
+    auto filter = cumulative::reduce<cumulative::moment_kurtosis<double>>(std::launch::deferred, data.begin(), data.end(), 7);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+    TRIAL_ONLINE_TEST_WITH(filter.mean(), expect.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.variance(), expect.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.skewness(), expect.skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.kurtosis(), expect.kurtosis(), tolerance);
+}
+
+void test_async()
+{
+    const auto tolerance = detail::close_to<double>(1e-9);
+    auto data = dataset(10000);
+    cumulative::moment_kurtosis<double> expect;
+    for (auto value : data)
+    {
+        expect.push(value);
+    }
+    auto filter = cumulative::reduce<cumulative::moment_kurtosis<double>>(std::launch::async, data.begin(), data.end(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+    TRIAL_ONLINE_TEST_WITH(filter.mean(), expect.mean(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.variance(), expect.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.skewness(), expect.skewness(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.kurtosis(), expect.kurtosis(), tolerance);
+}
+
+void test_deterministic()
+{
+    auto data = dataset(10000);
+    auto first = cumulative::reduce<cumulative::moment_kurtosis<double>>(std::launch::async, data.begin(), data.end(), 8);
+    auto second = cumulative::reduce<cumulative::moment_kurtosis<double>>(std::launch::deferred, data.begin(), data.end(), 8);
+    TRIAL_ONLINE_TEST_EQUAL(first.mean(), second.mean());
+    TRIAL_ONLINE_TEST_EQUAL(first.variance(), second.variance());
+    TRIAL_ONLINE_TEST_EQUAL(first.skewness(), second.skewness());
+    TRIAL_ONLINE_TEST_EQUAL(first.kurtosis(), second.kurtosis());
+}
+
+void test_more_partitions_than_data()
+{
+    std::vector<double> data = { 1.0, 2.0, 3.0 };
+    auto filter = cumulative::reduce<cumulative::moment_variance<double>>(std::launch::async, data.begin(), data.end(), 16);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), 0.666667, 1e-5);
+}
+
+void test_hardware_concurrency()
+{
+    auto data = dataset(1000);
+    auto filter = cumulative::reduce<cumulative::moment<double>>(std::launch::async, data.begin(), data.end());
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), data.size());
+}
+
+void run()
+{
+    test_empty();
+    test_deferred();
+    test_async();
+    test_deterministic();
+    test_more_partitions_than_data();
+    test_hardware_concurrency();
+}
+
+} // namespace moment_double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace moment_int_suite
+{
+
+void test_large()
+{
+    // Partitions are merged without overflow
+    std::vector<int> data(20000, 0);
+    std::fill(data.begin() + 10000, data.end(), 200);
+    auto filter = cumulative::reduce<cumulative::moment_variance<int>>(std::launch::deferred, data.begin(), data.end(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), data.size());
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 100);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 10000);
+}
+
+void run()
+{
+    test_large();
+}
+
+} // namespace moment_int_suite
+
+//-----------------------------------------------------------------------------
+
+namespace comoment_double_suite
+{
+
+std::vector<double> dataset(std::size_t size, std::size_t seed)
+{
+    std::vector<double> result;
+    result.reserve(size);
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        result.push_back(double((k * seed) % 23) + 1e-2 * double(k));
+    }
+    return result;
+}
+
+void test_covariance()
+{
+    const auto tolerance = detail::close_to<double>(1e-9);
+    auto x = dataset(1000, 3);
+    auto y = dataset(1000, 7);
+    cumulative::covariance<double> expect;
+    for (std::size_t k = 0; k < x.size(); ++k)
+    {
+        expect.push(x[k], y[k]);
+    }
+    auto filter = cumulative::reduce<cumulative::covariance<double>>(std::launch::async, x.begin(), x.end(), y.begin(), 5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+    TRIAL_ONLINE_TEST_WITH(filter.variance(), expect.variance(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.unbiased_variance(), expect.unbiased_variance(), tolerance);
+}
+
+void test_correlation()
+{
+    const auto tolerance = detail::close_to<double>(1e-9);
+    auto x = dataset(1000, 3);
+    auto y = dataset(1000, 7);
+    cumulative::correlation<double> expect;
+    for (std::size_t k = 0; k < x.size(); ++k)
+    {
+        expect.push(x[k], y[k]);
+    }
+    auto filter = cumulative::reduce<cumulative::correlation<double>>(std::launch::async, x.begin(), x.end(), y.begin());
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+    TRIAL_ONLINE_TEST_WITH(filter.value(), expect.value(), tolerance);
+}
+
+void test_regression()
+{
+    const auto tolerance = detail::close_to<double>(1e-9);
+    auto x = dataset(1000, 3);
+    auto y = dataset(1000, 7);
+    cumulative::regression<double> expect;
+    for (std::size_t k = 0; k < x.size(); ++k)
+    {
+        expect.push(x[k], y[k]);
+    }
+    auto filter = cumulative::reduce<cumulative::regression<double>>(std::launch::deferred, x.begin(), x.end(), y.begin(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+    TRIAL_ONLINE_TEST_WITH(filter.slope(), expect.slope(), tolerance);
+    TRIAL_ONLINE_TEST_WITH(filter.at(0.0), expect.at(0.0), tolerance);
+}
+
+void run()
+{
+    test_covariance();
+    test_correlation();
+    test_regression();
+}
+
+} // namespace comoment_double_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    moment_double_suite::run();
+    moment_int_suite::run();
+    comoment_double_suite::run();
+
+    return boost::report_errors();
+}
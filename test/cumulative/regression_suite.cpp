@@ -153,6 +153,29 @@ void test_scatter()
     TRIAL_ONLINE_TEST_CLOSE(filter.at(0), 0.785, tolerance);
 }
 
+void test_merge()
+{
+    const double tolerance = 1e-9;
+    const double x[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 };
+    const double y[] = { 2.0, 1.5, 4.0, 3.0, 2.25, 5.0, 4.5 };
+    cumulative::regression<double> filter;
+    cumulative::regression<double> lhs;
+    cumulative::regression<double> rhs;
+    for (int i = 0; i < 7; ++i)
+    {
+        filter.push(x[i], y[i]);
+        if (i < 5)
+            lhs.push(x[i], y[i]);
+        else
+            rhs.push(x[i], y[i]);
+    }
+    lhs += rhs;
+    TRIAL_ONLINE_TEST_EQUAL(lhs.size(), filter.size());
+    TRIAL_ONLINE_TEST_CLOSE(lhs.slope(), filter.slope(), tolerance);
+    TRIAL_ONLINE_TEST_CLOSE(lhs.at(0.0), filter.at(0.0), tolerance);
+    TRIAL_ONLINE_TEST_CLOSE(lhs.at(10.0), filter.at(10.0), tolerance);
+}
+
 void run()
 {
     test_ctor();
@@ -161,6 +184,7 @@ void run()
     test_linear_increase__offset();
     test_linear_decrease();
     test_scatter();
+    test_merge();
 }
 
 } // namespace cumulative_double
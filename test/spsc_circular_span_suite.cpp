@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <vector>
+#include <numeric>
+#include <thread>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/spsc_circular_span.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace api_suite
+{
+
+void test_ctor()
+{
+    int array[4];
+    spsc_circular_span<int> span(array);
+    TRIAL_ONLINE_TEST(span.empty());
+    TRIAL_ONLINE_TEST_EQUAL(span.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(span.capacity(), 4);
+}
+
+void test_push_pop()
+{
+    int array[3];
+    spsc_circular_span<int> span(array);
+    TRIAL_ONLINE_TEST(span.try_push(1));
+    TRIAL_ONLINE_TEST(span.try_push(2));
+    TRIAL_ONLINE_TEST(span.try_push(3));
+    TRIAL_ONLINE_TEST_EQUAL(span.size(), 3);
+    // Full
+    TRIAL_ONLINE_TEST(!span.try_push(4));
+    int value = 0;
+    TRIAL_ONLINE_TEST(span.try_pop(value));
+    TRIAL_ONLINE_TEST_EQUAL(value, 1);
+    TRIAL_ONLINE_TEST(span.try_push(4));
+    TRIAL_ONLINE_TEST(span.try_pop(value));
+    TRIAL_ONLINE_TEST_EQUAL(value, 2);
+    TRIAL_ONLINE_TEST(span.try_pop(value));
+    TRIAL_ONLINE_TEST_EQUAL(value, 3);
+    TRIAL_ONLINE_TEST(span.try_pop(value));
+    TRIAL_ONLINE_TEST_EQUAL(value, 4);
+    // Empty
+    TRIAL_ONLINE_TEST(!span.try_pop(value));
+    TRIAL_ONLINE_TEST(span.empty());
+}
+
+void test_push_pop_batch()
+{
+    std::array<int, 4> array;
+    spsc_circular_span<int> span(array.begin(), array.end());
+    std::vector<int> input = { 1, 2, 3, 4, 5, 6 };
+    TRIAL_ONLINE_TEST_EQUAL(span.try_push(input.begin(), input.begin() + 3), 3);
+    std::vector<int> output(4);
+    TRIAL_ONLINE_TEST_EQUAL(span.try_pop(output.begin(), 2), 2);
+    TRIAL_ONLINE_TEST_EQUAL(output[0], 1);
+    TRIAL_ONLINE_TEST_EQUAL(output[1], 2);
+    // Wraps around end of storage and only has room for three
+    TRIAL_ONLINE_TEST_EQUAL(span.try_push(input.begin() + 3, input.end()), 3);
+    TRIAL_ONLINE_TEST_EQUAL(span.try_push(input.begin(), input.end()), 0);
+    TRIAL_ONLINE_TEST_EQUAL(span.try_pop(output.begin(), 8), 4);
+    std::vector<int> expect = { 3, 4, 5, 6 };
+    TRIAL_ONLINE_TEST_ALL_EQUAL(output.begin(), output.end(),
+                                expect.begin(), expect.end());
+    TRIAL_ONLINE_TEST_EQUAL(span.try_pop(output.begin(), 8), 0);
+}
+
+void run()
+{
+    test_ctor();
+    test_push_pop();
+    test_push_pop_batch();
+}
+
+} // namespace api_suite
+
+//-----------------------------------------------------------------------------
+
+namespace thread_suite
+{
+
+void test_single()
+{
+    const int count = 100000;
+    std::array<int, 100> array;
+    spsc_circular_span<int> span(array.begin(), array.end());
+
+    std::thread producer([&span, count] {
+        for (int k = 0; k < count; ++k)
+        {
+            while (!span.try_push(k))
+                std::this_thread::yield();
+        }
+    });
+
+    int expect = 0;
+    bool ordered = true;
+    while (expect < count)
+    {
+        int value;
+        if (span.try_pop(value))
+        {
+            ordered = ordered && (value == expect);
+            ++expect;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    TRIAL_ONLINE_TEST(ordered);
+    TRIAL_ONLINE_TEST_EQUAL(expect, count);
+    TRIAL_ONLINE_TEST(span.empty());
+}
+
+void test_batch()
+{
+    const int count = 100000;
+    std::array<int, 64> array;
+    spsc_circular_span<int> span(array.begin(), array.end());
+
+    std::thread producer([&span, count] {
+        std::vector<int> input(37);
+        int next = 0;
+        while (next < count)
+        {
+            const auto length = std::min<std::size_t>(input.size(), count - next);
+            std::iota(input.begin(), input.begin() + length, next);
+            const auto pushed = span.try_push(input.begin(), input.begin() + length);
+            if (pushed == 0)
+                std::this_thread::yield();
+            next += int(pushed);
+        }
+    });
+
+    std::vector<int> output(29);
+    int expect = 0;
+    bool ordered = true;
+    while (expect < count)
+    {
+        const auto length = span.try_pop(output.begin(), output.size());
+        if (length == 0)
+            std::this_thread::yield();
+        for (std::size_t k = 0; k < length; ++k)
+        {
+            ordered = ordered && (output[k] == expect);
+            ++expect;
+        }
+    }
+    producer.join();
+    TRIAL_ONLINE_TEST(ordered);
+    TRIAL_ONLINE_TEST_EQUAL(expect, count);
+}
+
+void run()
+{
+    test_single();
+    test_batch();
+}
+
+} // namespace thread_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    api_suite::run();
+    thread_suite::run();
+
+    return boost::report_errors();
+}
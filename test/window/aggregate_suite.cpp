@@ -0,0 +1,249 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <deque>
+#include <random>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/detail/functional.hpp>
+#include <trial/online/cumulative/moment.hpp>
+#include <trial/online/window/aggregate.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+
+// Compare against aggregation over the entire window
+template <typename Filter>
+bool compare(Filter& filter, std::size_t count, int low, int high)
+{
+    using value_type = typename Filter::value_type;
+    typename Filter::monoid_type monoid;
+    std::default_random_engine generator(filter.capacity());
+    std::uniform_int_distribution<int> distribution(low, high);
+    std::deque<value_type> window;
+    bool result = true;
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        const auto input = value_type(distribution(generator));
+        filter.push(input);
+        window.push_back(input);
+        if (window.size() > filter.capacity())
+            window.pop_front();
+        auto expect = monoid.identity();
+        for (const auto& value : window)
+            expect = monoid(expect, value);
+        result = result && (filter.size() == window.size());
+        result = result && (filter.value() == expect);
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+
+namespace minimum_suite
+{
+
+void test_ctor()
+{
+    window::aggregate<double, 4, monoid::minimum<double>> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST(!filter.full());
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), std::numeric_limits<double>::infinity());
+}
+
+void test_decreasing()
+{
+    window::aggregate<int, 3, monoid::minimum<int>> filter;
+    filter.push(4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 4);
+    filter.push(3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 3);
+    filter.push(5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 3);
+    filter.push(6);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 3);
+    filter.push(7);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 5);
+    filter.push(8);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 6);
+    filter.clear();
+    TRIAL_ONLINE_TEST(filter.empty());
+    filter.push(9);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 9);
+}
+
+void test_random()
+{
+    {
+        window::aggregate<int, 1, monoid::minimum<int>> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 100, -100, 100));
+    }
+    {
+        window::aggregate<int, 7, monoid::minimum<int>> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 1000, -100, 100));
+    }
+    {
+        window::aggregate<double, dynamic_extent, monoid::minimum<double>> filter(33);
+        TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 33);
+        TRIAL_ONLINE_TEST(compare(filter, 1000, -100, 100));
+    }
+}
+
+void run()
+{
+    test_ctor();
+    test_decreasing();
+    test_random();
+}
+
+} // namespace minimum_suite
+
+//-----------------------------------------------------------------------------
+
+namespace maximum_suite
+{
+
+void test_random()
+{
+    {
+        window::aggregate<int, 5, monoid::maximum<int>> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 1000, -100, 100));
+    }
+    {
+        window::aggregate<double, dynamic_extent, monoid::maximum<double>> filter(64);
+        TRIAL_ONLINE_TEST(compare(filter, 1000, -100, 100));
+    }
+}
+
+void run()
+{
+    test_random();
+}
+
+} // namespace maximum_suite
+
+//-----------------------------------------------------------------------------
+
+namespace bit_or_suite
+{
+
+void test_flags()
+{
+    window::aggregate<unsigned, 2, monoid::bit_or<unsigned>> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 0U);
+    filter.push(1U);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 1U);
+    filter.push(2U);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 3U);
+    filter.push(4U);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 6U);
+    filter.push(4U);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 4U);
+}
+
+void test_random()
+{
+    window::aggregate<unsigned, 9, monoid::bit_or<unsigned>> filter;
+    TRIAL_ONLINE_TEST(compare(filter, 1000, 0, 1 << 12));
+}
+
+void run()
+{
+    test_flags();
+    test_random();
+}
+
+} // namespace bit_or_suite
+
+//-----------------------------------------------------------------------------
+
+namespace gcd_suite
+{
+
+void test_values()
+{
+    window::aggregate<int, 3, monoid::gcd<int>> filter;
+    filter.push(12);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 12);
+    filter.push(18);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 6);
+    filter.push(-8);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 2);
+    filter.push(27);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 1);
+    filter.push(36);
+    filter.push(45);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 9);
+}
+
+void test_random()
+{
+    window::aggregate<long, 6, monoid::gcd<long>> filter;
+    TRIAL_ONLINE_TEST(compare(filter, 1000, 1, 64));
+}
+
+void run()
+{
+    test_values();
+    test_random();
+}
+
+} // namespace gcd_suite
+
+//-----------------------------------------------------------------------------
+
+namespace merge_suite
+{
+
+void test_moment()
+{
+    using moment_type = cumulative::moment_variance<double>;
+    window::aggregate<moment_type, 4, monoid::merge<moment_type>> filter;
+    const double data[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 };
+    for (auto value : data)
+    {
+        moment_type single;
+        single.push(value);
+        filter.push(single);
+    }
+    // Window contains 4, 5, 6, 7
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().mean(), 5.5);
+    TRIAL_ONLINE_TEST_WITH(filter.value().variance(), 1.25, detail::close_to<double>());
+}
+
+void run()
+{
+    test_moment();
+}
+
+} // namespace merge_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    minimum_suite::run();
+    maximum_suite::run();
+    bit_or_suite::run();
+    gcd_suite::run();
+    merge_suite::run();
+
+    return boost::report_errors();
+}
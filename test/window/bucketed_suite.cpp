@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/cumulative/moment.hpp>
+#include <trial/online/window/bucketed.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace count_suite
+{
+
+using moment_type = cumulative::moment_variance<double>;
+
+void test_ctor()
+{
+    window::bucketed<moment_type, 4> filter(10);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().size(), 0);
+}
+
+void test_rotate_by_count()
+{
+    window::bucketed<moment_type, 4> filter(10);
+    for (int k = 0; k < 100; ++k)
+    {
+        filter.push(double(k));
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter[0].size(), 10);
+    TRIAL_ONLINE_TEST_EQUAL(filter[0].mean(), 64.5);
+    // Inputs 60 to 99
+    const auto result = filter.value();
+    TRIAL_ONLINE_TEST_EQUAL(result.size(), 40);
+    TRIAL_ONLINE_TEST_EQUAL(result.mean(), 79.5);
+    TRIAL_ONLINE_TEST_CLOSE(result.variance(), (40.0 * 40.0 - 1.0) / 12.0, 1e-9);
+
+    // Oldest bucket is dropped as a whole
+    filter.push(100.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().size(), 31);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().mean(), 85.0);
+}
+
+void test_rotate_manually()
+{
+    window::bucketed<moment_type, 2> filter;
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    filter.rotate();
+    filter.push(5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().mean(), 2.75);
+    filter.rotate();
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().mean(), 5.0);
+    filter.clear();
+    TRIAL_ONLINE_TEST(filter.empty());
+}
+
+void run()
+{
+    test_ctor();
+    test_rotate_by_count();
+    test_rotate_manually();
+}
+
+} // namespace count_suite
+
+//-----------------------------------------------------------------------------
+
+namespace time_suite
+{
+
+using moment_type = cumulative::moment<double>;
+using time_point = std::chrono::steady_clock::time_point;
+using std::chrono::seconds;
+using std::chrono::milliseconds;
+
+void test_slices()
+{
+    window::timed_bucketed<moment_type, 3> filter(seconds(1));
+    TRIAL_ONLINE_TEST(filter.slice() == seconds(1));
+    filter.push(time_point(milliseconds(0)), 1.0);
+    filter.push(time_point(milliseconds(999)), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    filter.push(time_point(milliseconds(1000)), 5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().mean(), 3.0);
+    // Skips empty slice
+    filter.push(time_point(milliseconds(3500)), 7.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter[0].size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter[1].size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().mean(), 6.0);
+    // All buckets expire
+    filter.expire(time_point(seconds(100)));
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().size(), 0);
+    filter.push(time_point(milliseconds(100500)), 9.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    filter.push(time_point(milliseconds(101000)), 11.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value().mean(), 10.0);
+}
+
+void run()
+{
+    test_slices();
+}
+
+} // namespace time_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    count_suite::run();
+    time_suite::run();
+
+    return boost::report_errors();
+}
@@ -352,10 +352,78 @@ void test_clear()
     TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
 }
 
+void test_copy()
+{
+    static_assert(std::is_trivially_copyable<window::covariance<double, 4>>::value, "window::covariance must be trivially copyable");
+
+    window::covariance<double, 2> filter;
+    filter.push(1.0, 1.0);
+    filter.push(2.0, 2.0);
+    auto copy = filter;
+    filter.push(4.0, 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.variance(), 0.25);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+}
+
+void test_dynamic()
+{
+    const double tolerance = 1e-6;
+    window::covariance<double, 4> expect;
+    window::covariance<double, dynamic_extent> filter(4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    for (int i = 0; i < 10; ++i)
+    {
+        const double x = double(i);
+        const double y = double(i * i);
+        expect.push(x, y);
+        filter.push(x, y);
+        TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+        TRIAL_ONLINE_TEST_CLOSE(filter.variance(), expect.variance(), tolerance);
+    }
+}
+
+void test_dynamic_external_storage()
+{
+    using filter_type = window::covariance<double, dynamic_extent>;
+    double storage[4];
+    filter_type filter(storage, storage + 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 2);
+    filter.push(1.0, 1.0);
+    filter.push(2.0, 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.25);
+    filter.push(4.0, 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+}
+
+void test_shared_index()
+{
+    // x and y share one ring index
+    static_assert(sizeof(window::covariance<double, 1024>) == 2 * 1024 * sizeof(double) + 2 * sizeof(std::size_t) + 3 * sizeof(double), "x and y must share ring index");
+
+    window::covariance<double, dynamic_extent> filter(3);
+    for (int i = 0; i < 10; ++i)
+    {
+        filter.push(double(i), double(2 * i));
+    }
+    auto copy = filter;
+    TRIAL_ONLINE_TEST_EQUAL(copy.size(), 3);
+    // Window with 7, 8, and 9
+    TRIAL_ONLINE_TEST_CLOSE(copy.variance(), 2.0 * 2.0 / 3.0, 1e-12);
+    copy.push(0.0, 0.0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), 2.0 * 2.0 / 3.0, 1e-12);
+    // Window with 8, 9, and 0
+    TRIAL_ONLINE_TEST_CLOSE(copy.variance(), 2.0 * 146.0 / 9.0, 1e-12);
+}
+
 void run()
 {
     test_empty();
     test_clear();
+    test_copy();
+    test_dynamic();
+    test_dynamic_external_storage();
+    test_shared_index();
     test_same_no_increment();
     test_same_increment_by_one();
     test_same_increment_by_half();
@@ -364,6 +432,55 @@ void run()
 
 } // namespace double_suite
 
+//-----------------------------------------------------------------------------
+
+namespace storage_suite
+{
+
+void test_float()
+{
+    using filter_type = window::basic_comoment<double, 4, with::variance, float>;
+    static_assert(sizeof(filter_type) < sizeof(window::covariance<double, 4>), "Storage must reduce size");
+
+    filter_type filter;
+    for (int k = 0; k < 1000; ++k)
+    {
+        filter.push(0.1 * k, 1e6 + 0.3 * k);
+    }
+    // Sums track the stored precision
+    window::covariance<double, 4> expect;
+    for (int k = 996; k < 1000; ++k)
+    {
+        expect.push(double(float(0.1 * k)), double(float(1e6 + 0.3 * k)));
+    }
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), expect.variance(), 1e-6);
+}
+
+void test_dynamic_external_storage()
+{
+    using filter_type = window::basic_comoment<double, dynamic_extent, with::variance, float>;
+    float storage[4];
+    filter_type filter(storage, storage + 4);
+    filter.push(1.0, 10.0);
+    filter.push(2.0, 20.0);
+    filter.push(4.0, 40.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 2);
+    // Separate x and y rings
+    TRIAL_ONLINE_TEST_EQUAL(storage[0], 4.0f);
+    TRIAL_ONLINE_TEST_EQUAL(storage[1], 2.0f);
+    TRIAL_ONLINE_TEST_EQUAL(storage[2], 40.0f);
+    TRIAL_ONLINE_TEST_EQUAL(storage[3], 20.0f);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 10.0);
+}
+
+void run()
+{
+    test_float();
+    test_dynamic_external_storage();
+}
+
+} // namespace storage_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -372,6 +489,7 @@ int main()
 {
     properties_suite::run();
     double_suite::run();
+    storage_suite::run();
 
     return boost::report_errors();
 }
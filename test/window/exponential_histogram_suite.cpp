@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/window/exponential_histogram.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace count_suite
+{
+
+void test_ctor()
+{
+    window::exponential_histogram<> filter(100, 0.1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 100);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.buckets(), 0);
+}
+
+void test_exact()
+{
+    // Counts are exact until buckets are merged
+    window::exponential_histogram<> filter(100, 0.1);
+    for (int k = 0; k < 11; ++k)
+    {
+        filter.push(1);
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 11);
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 11);
+    TRIAL_ONLINE_TEST_EQUAL(filter.error(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.buckets(), 11);
+    filter.push(0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 12);
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 11);
+    filter.push(1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 12);
+    TRIAL_ONLINE_TEST_EQUAL(filter.buckets(), 11);
+}
+
+void test_sparse()
+{
+    // Few inputs after the window has been filled with zeroes
+    window::exponential_histogram<> filter(100, 0.1);
+    for (int k = 0; k < 200; ++k)
+    {
+        filter.push(0);
+    }
+    for (int k = 0; k < 12; ++k)
+    {
+        filter.push(1);
+        const double exact = k + 1;
+        TRIAL_ONLINE_TEST(std::abs(double(filter.sum()) - exact) <= 0.1 * exact);
+    }
+}
+
+void test_expire()
+{
+    window::exponential_histogram<> filter(4, 0.5);
+    filter.push(1);
+    filter.push(1);
+    filter.push(0);
+    filter.push(0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 2);
+    filter.push(0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 1);
+    filter.push(0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.buckets(), 0);
+}
+
+template <typename Generator>
+void check_random(std::size_t window_size, double epsilon, Generator next)
+{
+    window::exponential_histogram<> filter(window_size, epsilon);
+    std::vector<int> inputs;
+    for (int k = 0; k < 20000; ++k)
+    {
+        const int input = next() ? 1 : 0;
+        inputs.push_back(input);
+        filter.push(input);
+
+        std::size_t exact = 0;
+        for (std::size_t i = inputs.size() - filter.size(); i < inputs.size(); ++i)
+        {
+            exact += inputs[i];
+        }
+        const double estimate = double(filter.sum());
+        TRIAL_ONLINE_TEST(std::abs(estimate - exact) <= epsilon * exact);
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), window_size);
+}
+
+void test_random()
+{
+    std::default_random_engine generator(42);
+    std::bernoulli_distribution distribution(0.3);
+    check_random(1000, 0.1, [&] { return distribution(generator); });
+    check_random(1000, 0.01, [&] { return distribution(generator); });
+}
+
+void test_random_sparse()
+{
+    std::default_random_engine generator(42);
+    std::bernoulli_distribution distribution(0.005);
+    check_random(1000, 0.1, [&] { return distribution(generator); });
+    check_random(100, 0.1, [&] { return distribution(generator); });
+}
+
+void test_random_bursty()
+{
+    // Alternating runs of mostly ones and only zeroes
+    std::default_random_engine generator(42);
+    std::bernoulli_distribution toggle(0.02);
+    std::bernoulli_distribution distribution(0.9);
+    bool burst = false;
+    auto next = [&]
+    {
+        if (toggle(generator))
+            burst = !burst;
+        return burst && distribution(generator);
+    };
+    check_random(1000, 0.1, next);
+    check_random(1000, 0.01, next);
+    check_random(100, 0.3, next);
+}
+
+void test_buckets()
+{
+    window::exponential_histogram<> filter(1000, 0.1);
+    for (int k = 0; k < 5000; ++k)
+    {
+        filter.push(1);
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 1000);
+    TRIAL_ONLINE_TEST(filter.buckets() < 128);
+}
+
+void run()
+{
+    test_ctor();
+    test_exact();
+    test_sparse();
+    test_expire();
+    test_random();
+    test_random_sparse();
+    test_random_bursty();
+    test_buckets();
+}
+
+} // namespace count_suite
+
+//-----------------------------------------------------------------------------
+
+namespace sum_suite
+{
+
+void test_exact()
+{
+    window::exponential_histogram<> filter(100, 0.1);
+    filter.push(5);
+    filter.push(8);
+    TRIAL_ONLINE_TEST_EQUAL(filter.sum(), 13);
+    // Eleven buckets of size one and one of size two
+    TRIAL_ONLINE_TEST_EQUAL(filter.buckets(), 12);
+}
+
+void test_random()
+{
+    const std::size_t window_size = 4096;
+    const double epsilon = 0.05;
+    window::exponential_histogram<std::uint64_t> filter(window_size, epsilon);
+    std::vector<std::uint64_t> inputs;
+    std::default_random_engine generator(42);
+    std::uniform_int_distribution<std::uint64_t> distribution(0, 1000);
+    for (int k = 0; k < 20000; ++k)
+    {
+        const auto input = distribution(generator);
+        inputs.push_back(input);
+        filter.push(input);
+
+        if (k % 97 == 0)
+        {
+            std::uint64_t exact = 0;
+            for (std::size_t i = inputs.size() - filter.size(); i < inputs.size(); ++i)
+            {
+                exact += inputs[i];
+            }
+            const double estimate = double(filter.sum());
+            TRIAL_ONLINE_TEST(std::abs(estimate - exact) <= epsilon * exact);
+        }
+    }
+    TRIAL_ONLINE_TEST(filter.buckets() < 512);
+}
+
+void run()
+{
+    test_exact();
+    test_random();
+}
+
+} // namespace sum_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    count_suite::run();
+    sum_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2018 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <algorithm>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/window/extreme.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace double_suite
+{
+
+void test_ctor()
+{
+    window::extreme<double, 4> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST(!filter.full());
+}
+
+void test_increasing()
+{
+    window::extreme<double, 3> filter;
+    filter.push(1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.min(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.max(), 1.0);
+    filter.push(2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.min(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.max(), 2.0);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.min(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.max(), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmin(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmax(), 2);
+    filter.push(4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.min(), 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.max(), 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmin(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmax(), 2);
+}
+
+void test_decreasing()
+{
+    window::extreme<double, 3> filter;
+    filter.push(4.0);
+    filter.push(3.0);
+    filter.push(2.0);
+    filter.push(1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.min(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.max(), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmin(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmax(), 0);
+}
+
+void test_ties()
+{
+    window::extreme<double, 4> filter;
+    filter.push(1.0);
+    filter.push(5.0);
+    filter.push(1.0);
+    filter.push(5.0);
+    // Oldest of equal values
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmin(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmax(), 1);
+    filter.push(0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.min(), 0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmin(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.max(), 5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.argmax(), 0);
+}
+
+void test_clear()
+{
+    window::extreme<double, 2> filter;
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.clear();
+    TRIAL_ONLINE_TEST(filter.empty());
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.min(), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.max(), 3.0);
+}
+
+void run()
+{
+    test_ctor();
+    test_increasing();
+    test_decreasing();
+    test_ties();
+    test_clear();
+}
+
+} // namespace double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace scan_suite
+{
+
+// Compare with scan over window
+
+template <typename Filter>
+void compare(Filter& filter, const std::vector<int>& input)
+{
+    const std::size_t window = filter.capacity();
+    for (std::size_t k = 0; k < input.size(); ++k)
+    {
+        filter.push(input[k]);
+        const auto first = input.begin() + ((k + 1 > window) ? k + 1 - window : 0);
+        const auto last = input.begin() + k + 1;
+        const auto minimum = std::min_element(first, last);
+        const auto maximum = std::max_element(first, last);
+        TRIAL_ONLINE_TEST_EQUAL(filter.size(), std::size_t(last - first));
+        TRIAL_ONLINE_TEST_EQUAL(filter.min(), *minimum);
+        TRIAL_ONLINE_TEST_EQUAL(filter.max(), *maximum);
+        TRIAL_ONLINE_TEST_EQUAL(filter.argmin(), std::size_t(minimum - first));
+        TRIAL_ONLINE_TEST_EQUAL(filter.argmax(), std::size_t(maximum - first));
+    }
+}
+
+std::vector<int> dataset()
+{
+    std::vector<int> input;
+    for (int k = 0; k < 500; ++k)
+        input.push_back((k * 7919) % 31 - (k % 17));
+    return input;
+}
+
+void test_fixed()
+{
+    window::extreme<int, 1> one;
+    compare(one, dataset());
+    window::extreme<int, 7> seven;
+    compare(seven, dataset());
+    window::extreme<int, 64> many;
+    compare(many, dataset());
+}
+
+void test_dynamic()
+{
+    window::extreme<int, dynamic_extent> filter(13);
+    compare(filter, dataset());
+}
+
+void run()
+{
+    test_fixed();
+    test_dynamic();
+}
+
+} // namespace scan_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    double_suite::run();
+    scan_suite::run();
+
+    return boost::report_errors();
+}
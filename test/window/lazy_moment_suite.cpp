@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/window/moment.hpp>
+#include <trial/online/window/lazy_moment.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace mean_suite
+{
+
+void test_ctor()
+{
+    window::lazy_moment<double, 4> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST(!filter.full());
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0.0);
+}
+
+void test_sliding()
+{
+    window::lazy_moment<double, 3> filter;
+    filter.push(1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 1.0);
+    filter.push(2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 1.5);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    TRIAL_ONLINE_TEST(filter.full());
+    filter.push(7.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 4.0);
+    filter.clear();
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0.0);
+}
+
+void test_int()
+{
+    window::lazy_moment<std::int16_t, 2> filter;
+    filter.push(30000);
+    filter.push(30000);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 30000);
+    filter.push(-29999);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0); // Rounded towards zero
+}
+
+void run()
+{
+    test_ctor();
+    test_sliding();
+    test_int();
+}
+
+} // namespace mean_suite
+
+//-----------------------------------------------------------------------------
+
+namespace variance_suite
+{
+
+void test_int()
+{
+    window::lazy_moment_variance<int, 3> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+    filter.push(1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+    filter.push(3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), 2.0);
+    filter.push(-4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), 26.0 / 3.0, 1e-12);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), 13.0);
+    filter.push(3);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), 98.0 / 9.0, 1e-12);
+}
+
+void test_small_type()
+{
+    // Sums are wider than the input type
+    window::lazy_moment_variance<std::int16_t, 4> filter;
+    window::moment_variance<std::int16_t, 4> expect;
+    const std::int16_t inputs[] = { 30000, -30000, 30000, 29999, -29999, 12345 };
+    for (auto input : inputs)
+    {
+        filter.push(input);
+        expect.push(input);
+        TRIAL_ONLINE_TEST_EQUAL(filter.variance(), expect.variance());
+        TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), expect.unbiased_variance());
+    }
+}
+
+void run()
+{
+    test_int();
+    test_small_type();
+}
+
+} // namespace variance_suite
+
+//-----------------------------------------------------------------------------
+
+namespace kurtosis_suite
+{
+
+template <typename Filter>
+bool compare(Filter& filter, std::size_t count)
+{
+    window::basic_moment<double, dynamic_extent, with::kurtosis, typename Filter::storage_type> expect(filter.capacity());
+    std::default_random_engine generator(filter.capacity());
+    std::normal_distribution<double> distribution(10.0, 3.0);
+    bool result = true;
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        const auto input = distribution(generator);
+        filter.push(input);
+        expect.push(input);
+        result = result && (filter.size() == expect.size());
+        result = result && (std::abs(filter.mean() - expect.mean()) < 1e-9);
+        result = result && (std::abs(filter.variance() - expect.variance()) < 1e-9);
+        result = result && (std::abs(filter.unbiased_variance() - expect.unbiased_variance()) < 1e-9);
+        result = result && (std::abs(filter.skewness() - expect.skewness()) < 1e-6);
+        result = result && (std::abs(filter.unbiased_skewness() - expect.unbiased_skewness()) < 1e-6);
+        result = result && (std::abs(filter.kurtosis() - expect.kurtosis()) < 1e-6);
+        result = result && (std::abs(filter.unbiased_kurtosis() - expect.unbiased_kurtosis()) < 1e-6);
+    }
+    return result;
+}
+
+void test_fixed()
+{
+    {
+        window::lazy_moment_kurtosis<double, 1> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 10));
+    }
+    {
+        window::lazy_moment_kurtosis<double, 5> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 100));
+    }
+    {
+        window::lazy_moment_kurtosis<double, 64> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 500));
+    }
+}
+
+void test_dynamic()
+{
+    window::lazy_moment_kurtosis<double, dynamic_extent> filter(37);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 37);
+    TRIAL_ONLINE_TEST(compare(filter, 500));
+}
+
+void test_storage()
+{
+    float storage[16];
+    window::basic_lazy_moment<double, dynamic_extent, with::kurtosis, float> filter(storage, storage + 16);
+    TRIAL_ONLINE_TEST(compare(filter, 200));
+}
+
+void run()
+{
+    test_fixed();
+    test_dynamic();
+    test_storage();
+}
+
+} // namespace kurtosis_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    mean_suite::run();
+    variance_suite::run();
+    kurtosis_suite::run();
+
+    return boost::report_errors();
+}
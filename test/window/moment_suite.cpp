@@ -8,9 +8,13 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
+#include <cstring>
+#include <vector>
 #include <trial/online/detail/lightweight_test.hpp>
 #include <trial/online/detail/functional.hpp>
 #include <trial/online/window/moment.hpp>
+#include <trial/online/cumulative/moment.hpp>
 
 using namespace trial::online;
 
@@ -627,6 +631,516 @@ void run()
 
 } // namespace variance_double_2_suite
 
+//-----------------------------------------------------------------------------
+
+namespace variance_int_suite
+{
+
+void test_ctor()
+{
+    window::moment_variance<int, 3> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 3);
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), 0.0);
+}
+
+void test_sliding()
+{
+    window::moment_variance<int, 3> filter;
+    filter.push(1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+    filter.push(3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), 2.0);
+    filter.push(-4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), 26.0 / 3.0, 1e-12);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), 13.0);
+    filter.push(3);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), 98.0 / 9.0, 1e-12);
+    filter.clear();
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+}
+
+void test_small_type()
+{
+    // Sums are wider than the input type
+    window::moment_variance<std::int16_t, 4> filter;
+    for (int k = 0; k < 10; ++k)
+    {
+        filter.push(30000);
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 30000);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+    filter.push(-30000);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 15000);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 675000000.0);
+}
+
+void test_unsigned()
+{
+    window::moment_variance<unsigned, 2> filter;
+    filter.push(4000000000U);
+    filter.push(4000000002U);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 4000000001U);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+    filter.push(1U);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2000000001U);
+}
+
+void test_no_drift()
+{
+    // Nanosecond timestamps
+    window::moment_variance<std::int64_t, 4> filter;
+    const std::int64_t offset = 1000000000000000;
+    for (std::int64_t k = 0; k < 10001; ++k)
+    {
+        filter.push(offset + (k % 7) * 1000);
+    }
+    filter.push(1);
+    filter.push(2);
+    filter.push(3);
+    filter.push(4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.25);
+}
+
+void run()
+{
+    test_ctor();
+    test_sliding();
+    test_small_type();
+    test_unsigned();
+    test_no_drift();
+}
+
+} // namespace variance_int_suite
+
+//-----------------------------------------------------------------------------
+
+namespace skewness_double_suite
+{
+
+// Reference computed by a cumulative filter over the last N values
+template <std::size_t N>
+cumulative::moment_kurtosis<double> reference(const std::vector<double>& input, std::size_t last)
+{
+    cumulative::moment_kurtosis<double> result;
+    const std::size_t first = (last > N) ? last - N : 0;
+    for (std::size_t k = first; k < last; ++k)
+        result.push(input[k]);
+    return result;
+}
+
+void test_ctor()
+{
+    window::moment_skewness<double, 4> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.skewness(), 0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_skewness(), 0.0);
+}
+
+void test_same()
+{
+    window::moment_skewness<double, 4> filter;
+    for (int i = 0; i < 10; ++i)
+    {
+        filter.push(1.0);
+        TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 1.0);
+        TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+        TRIAL_ONLINE_TEST_EQUAL(filter.skewness(), 0.0);
+    }
+}
+
+void test_sliding()
+{
+    const double tolerance = 1e-6;
+    const std::vector<double> input = { 1.0, 2.0, 9.0, 4.0, -3.0, 2.0, 2.5, 8.0, -1.0, 0.0, 7.0, 3.0 };
+    window::moment_skewness<double, 4> filter;
+    for (std::size_t k = 0; k < input.size(); ++k)
+    {
+        filter.push(input[k]);
+        const auto expect = reference<4>(input, k + 1);
+        TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+        TRIAL_ONLINE_TEST_CLOSE(filter.mean(), expect.mean(), tolerance);
+        TRIAL_ONLINE_TEST_CLOSE(filter.variance(), expect.variance(), tolerance);
+        TRIAL_ONLINE_TEST_CLOSE(filter.skewness(), expect.skewness(), tolerance);
+    }
+}
+
+void test_skewed()
+{
+    const double tolerance = 1e-6;
+    window::moment_skewness<double, 3> filter;
+    filter.push(100.0);
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.skewness(), 0.0, tolerance);
+    filter.push(10.0);
+    // Right tail
+    TRIAL_ONLINE_TEST(filter.skewness() > 0.0);
+    filter.push(5.0);
+    filter.push(6.0);
+    filter.push(-30.0);
+    // Left tail
+    TRIAL_ONLINE_TEST(filter.skewness() < 0.0);
+}
+
+void test_one()
+{
+    window::moment_skewness<double, 1> filter;
+    filter.push(1.0);
+    filter.push(2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.skewness(), 0.0);
+}
+
+void run()
+{
+    test_ctor();
+    test_same();
+    test_sliding();
+    test_skewed();
+    test_one();
+}
+
+} // namespace skewness_double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace kurtosis_double_suite
+{
+
+using skewness_double_suite::reference;
+
+void test_ctor()
+{
+    window::moment_kurtosis<double, 4> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.kurtosis(), 0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_kurtosis(), 0.0);
+}
+
+void test_sliding()
+{
+    const double tolerance = 1e-6;
+    const std::vector<double> input = { 1.0, 2.0, 9.0, 4.0, -3.0, 2.0, 2.5, 8.0, -1.0, 0.0, 7.0, 3.0 };
+    window::moment_kurtosis<double, 5> filter;
+    for (std::size_t k = 0; k < input.size(); ++k)
+    {
+        filter.push(input[k]);
+        const auto expect = reference<5>(input, k + 1);
+        TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+        TRIAL_ONLINE_TEST_CLOSE(filter.variance(), expect.variance(), tolerance);
+        TRIAL_ONLINE_TEST_CLOSE(filter.skewness(), expect.skewness(), tolerance);
+        TRIAL_ONLINE_TEST_CLOSE(filter.kurtosis(), expect.kurtosis(), tolerance);
+        TRIAL_ONLINE_TEST_CLOSE(filter.unbiased_kurtosis(), expect.unbiased_kurtosis(), tolerance);
+    }
+}
+
+void test_long()
+{
+    // Sliding updates stay close to recomputation over many pushes
+    const double tolerance = 1e-6;
+    std::vector<double> input;
+    for (int k = 0; k < 10000; ++k)
+        input.push_back(double((k * 7919) % 101) - 30.0);
+    window::moment_kurtosis<double, 64> filter;
+    for (auto value : input)
+        filter.push(value);
+    const auto expect = reference<64>(input, input.size());
+    TRIAL_ONLINE_TEST_CLOSE(filter.mean(), expect.mean(), tolerance);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), expect.variance(), tolerance);
+    TRIAL_ONLINE_TEST_CLOSE(filter.skewness(), expect.skewness(), tolerance);
+    TRIAL_ONLINE_TEST_CLOSE(filter.kurtosis(), expect.kurtosis(), tolerance);
+}
+
+void test_dynamic()
+{
+    const double tolerance = 1e-6;
+    const std::vector<double> input = { 1.0, 2.0, 9.0, 4.0, -3.0, 2.0, 2.5, 8.0, -1.0, 0.0, 7.0, 3.0 };
+    window::moment_kurtosis<double, dynamic_extent> filter(5);
+    for (std::size_t k = 0; k < input.size(); ++k)
+    {
+        filter.push(input[k]);
+        const auto expect = reference<5>(input, k + 1);
+        TRIAL_ONLINE_TEST_CLOSE(filter.kurtosis(), expect.kurtosis(), tolerance);
+    }
+}
+
+void run()
+{
+    test_ctor();
+    test_sliding();
+    test_long();
+    test_dynamic();
+}
+
+} // namespace kurtosis_double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace copy_suite
+{
+
+static_assert(std::is_trivially_copyable<window::moment<double, 4>>::value, "window::moment must be trivially copyable");
+static_assert(std::is_trivially_copyable<window::moment_variance<double, 4>>::value, "window::moment_variance must be trivially copyable");
+
+void test_copy()
+{
+    window::moment_variance<double, 2> filter;
+    filter.push(1.0);
+    filter.push(3.0);
+    auto copy = filter;
+    filter.push(5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.mean(), 2.0);
+    copy.push(7.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.mean(), 5.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.variance(), 4.0);
+}
+
+void test_memcpy()
+{
+    window::moment_variance<double, 2> filter;
+    filter.push(1.0);
+    filter.push(3.0);
+    window::moment_variance<double, 2> copy;
+    std::memcpy(&copy, &filter, sizeof(filter));
+    filter.clear();
+    TRIAL_ONLINE_TEST_EQUAL(copy.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(copy.mean(), 2.0);
+    copy.push(5.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.mean(), 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.variance(), 1.0);
+}
+
+void run()
+{
+    test_copy();
+    test_memcpy();
+}
+
+} // namespace copy_suite
+
+//-----------------------------------------------------------------------------
+
+namespace dynamic_double_suite
+{
+
+void test_ctor()
+{
+    window::moment_variance<double, dynamic_extent> filter(3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.empty(), true);
+    TRIAL_ONLINE_TEST_EQUAL(filter.full(), false);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+}
+
+void test_same_as_fixed()
+{
+    const double tolerance = 1e-6;
+    window::moment_variance<double, 3> expect;
+    window::moment_variance<double, dynamic_extent> filter(3);
+    for (int i = 0; i < 10; ++i)
+    {
+        const double value = double(i * i);
+        expect.push(value);
+        filter.push(value);
+        TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+        TRIAL_ONLINE_TEST_CLOSE(filter.mean(), expect.mean(), tolerance);
+        TRIAL_ONLINE_TEST_CLOSE(filter.variance(), expect.variance(), tolerance);
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.full(), true);
+}
+
+void test_external_storage()
+{
+    double storage[2];
+    window::moment<double, dynamic_extent> filter(storage, storage + 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 2);
+    filter.push(1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 1.0);
+    filter.push(2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 1.5);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.5);
+}
+
+void test_large()
+{
+    const std::size_t capacity = 86400;
+    window::moment<double, dynamic_extent> filter(capacity);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), capacity);
+    for (std::size_t i = 0; i < 2 * capacity; ++i)
+    {
+        filter.push(double(i % 2));
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), capacity);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0.5);
+}
+
+void test_copy()
+{
+    window::moment<double, dynamic_extent> filter(2);
+    filter.push(1.0);
+    auto copy = filter;
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.mean(), 1.0);
+    copy.push(5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.mean(), 3.0);
+}
+
+void run()
+{
+    test_ctor();
+    test_copy();
+    test_same_as_fixed();
+    test_external_storage();
+    test_large();
+}
+
+} // namespace dynamic_double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace drift_suite
+{
+
+void test_mean()
+{
+    window::moment<float, 4> filter;
+    for (int k = 0; k < 1000; ++k)
+    {
+        filter.push(1e7f + k);
+    }
+    filter.push(1.0f);
+    filter.push(2.0f);
+    filter.push(3.0f);
+    filter.push(4.0f);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.5f);
+}
+
+void test_variance()
+{
+    window::moment_variance<double, 4> filter;
+    for (int k = 0; k < 1000; ++k)
+    {
+        filter.push(1e9 + 0.1 * k);
+    }
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(3.0);
+    filter.push(4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.25);
+}
+
+void test_kurtosis()
+{
+    window::moment_kurtosis<double, dynamic_extent> filter(4);
+    for (int k = 0; k < 1000; ++k)
+    {
+        filter.push(1e6 + 0.1 * k * k);
+    }
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(3.0);
+    filter.push(4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.25);
+    TRIAL_ONLINE_TEST_EQUAL(filter.skewness(), 0.0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.kurtosis(), 1.64, 1e-12);
+}
+
+void run()
+{
+    test_mean();
+    test_variance();
+    test_kurtosis();
+}
+
+} // namespace drift_suite
+
+//-----------------------------------------------------------------------------
+
+namespace storage_suite
+{
+
+void test_float()
+{
+    using filter_type = window::basic_moment<double, 1024, with::variance, float>;
+    static_assert(sizeof(filter_type) < sizeof(window::moment_variance<double, 1024>) * 3 / 4, "Storage must reduce size");
+
+    filter_type filter;
+    filter.push(0.1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), double(0.1f));
+    filter.push(0.2);
+    TRIAL_ONLINE_TEST_CLOSE(filter.mean(), (double(0.1f) + double(0.2f)) / 2, 1e-15);
+}
+
+void test_sliding()
+{
+    // Sums are recalculated from the stored values
+    window::basic_moment<double, 3, with::kurtosis, float> filter;
+    for (int k = 0; k < 999; ++k)
+    {
+        filter.push(1e3 + 0.1 * k);
+    }
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.mean(), 2.0, 1e-12);
+    TRIAL_ONLINE_TEST_CLOSE(filter.variance(), 2.0 / 3.0, 1e-12);
+    TRIAL_ONLINE_TEST_CLOSE(filter.skewness(), 0.0, 1e-6);
+}
+
+void test_integer()
+{
+    // Integer samples with floating-point sums
+    window::basic_moment<double, 2, with::variance, std::uint32_t> filter;
+    filter.push(1000000000.0);
+    filter.push(1000000002.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 1000000001.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+}
+
+void test_dynamic_external_storage()
+{
+    float storage[2];
+    window::basic_moment<double, dynamic_extent, with::variance, float> filter(storage, storage + 2);
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(4.0);
+    TRIAL_ONLINE_TEST_EQUAL(storage[0], 4.0f);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+}
+
+void run()
+{
+    test_float();
+    test_sliding();
+    test_integer();
+    test_dynamic_external_storage();
+}
+
+} // namespace storage_suite
+
 //-----------------------------------------------------------------------------
 // main
 //-----------------------------------------------------------------------------
@@ -642,6 +1156,15 @@ int main()
 
     variance_double_1_suite::run();
     variance_double_2_suite::run();
+    variance_int_suite::run();
+
+    skewness_double_suite::run();
+    kurtosis_double_suite::run();
+
+    copy_suite::run();
+    dynamic_double_suite::run();
+    drift_suite::run();
+    storage_suite::run();
 
     return boost::report_errors();
 }
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <random>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/window/moment.hpp>
+#include <trial/online/window/multi_moment.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace mean_double_suite
+{
+
+void test_ctor()
+{
+    window::multi_moment<double, 2, 4> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.horizon_count, 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(0), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(1), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(0), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(0), 0.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(1), 0.0);
+}
+
+void test_horizons()
+{
+    window::multi_moment<double, 2, 4> filter;
+    filter.push(1.0);
+    filter.push(2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(0), 1.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(1), 1.5);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(0), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(1), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(0), 2.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(1), 2.0);
+    filter.push(4.0);
+    filter.push(5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(0), 4.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(1), 3.5);
+    filter.clear();
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(1), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(1), 0.0);
+}
+
+void run()
+{
+    test_ctor();
+    test_horizons();
+}
+
+} // namespace mean_double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace variance_double_suite
+{
+
+void test_compare()
+{
+    static_assert(std::is_trivially_copyable<window::multi_moment_variance<double, 3, 7, 5>>::value, "multi_moment must be trivially copyable");
+
+    window::multi_moment_variance<double, 3, 7, 5> filter;
+    window::moment_variance<double, 3> expect_3;
+    window::moment_variance<double, 7> expect_7;
+    window::moment_variance<double, 5> expect_5;
+    std::default_random_engine generator(7);
+    std::normal_distribution<double> distribution(100.0, 5.0);
+    bool result = true;
+    for (int k = 0; k < 1000; ++k)
+    {
+        const auto input = distribution(generator);
+        filter.push(input);
+        expect_3.push(input);
+        expect_7.push(input);
+        expect_5.push(input);
+        result = result && (filter.size(0) == expect_3.size());
+        result = result && (filter.size(1) == expect_7.size());
+        result = result && (filter.size(2) == expect_5.size());
+        result = result && (std::abs(filter.mean(0) - expect_3.mean()) < 1e-9);
+        result = result && (std::abs(filter.mean(1) - expect_7.mean()) < 1e-9);
+        result = result && (std::abs(filter.mean(2) - expect_5.mean()) < 1e-9);
+        result = result && (std::abs(filter.variance(0) - expect_3.variance()) < 1e-6);
+        result = result && (std::abs(filter.variance(1) - expect_7.variance()) < 1e-6);
+        result = result && (std::abs(filter.variance(2) - expect_5.variance()) < 1e-6);
+        result = result && (std::abs(filter.unbiased_variance(2) - expect_5.unbiased_variance()) < 1e-6);
+    }
+    TRIAL_ONLINE_TEST(result);
+}
+
+void test_resync()
+{
+    window::multi_moment_variance<double, 2, 4> filter;
+    for (int k = 0; k < 1000; ++k)
+    {
+        filter.push(1e9 + 0.1 * k);
+    }
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(3.0);
+    filter.push(4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(0), 3.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(0), 0.25);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(1), 2.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(1), 1.25);
+}
+
+void run()
+{
+    test_compare();
+    test_resync();
+}
+
+} // namespace variance_double_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    mean_double_suite::run();
+    variance_double_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <deque>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/window/quantile.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+
+// Reference quantile with linear interpolation between nearest ranks
+double reference(const std::deque<double>& window, double ratio)
+{
+    std::vector<double> sorted(window.begin(), window.end());
+    std::sort(sorted.begin(), sorted.end());
+    const auto position = (sorted.size() - 1) * ratio;
+    const auto rank = std::size_t(position);
+    if (rank + 1 >= sorted.size())
+        return sorted[rank];
+    return sorted[rank] + (position - rank) * (sorted[rank + 1] - sorted[rank]);
+}
+
+template <typename Filter>
+bool compare(Filter& filter, std::size_t capacity, std::size_t count, int range)
+{
+    std::default_random_engine generator(capacity);
+    std::uniform_int_distribution<int> distribution(-range, range);
+    std::deque<double> window;
+    bool result = true;
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        const double input = distribution(generator);
+        filter.push(input);
+        window.push_back(input);
+        if (window.size() > capacity)
+            window.pop_front();
+        result = result && (filter.size() == window.size());
+        result = result && (filter.template get<0>() == reference(window, 0.0));
+        result = result && (filter.template get<1>() == reference(window, 0.25));
+        result = result && (filter.template get<2>() == reference(window, 0.5));
+        result = result && (filter.template get<3>() == reference(window, 0.75));
+        result = result && (filter.template get<4>() == reference(window, 1.0));
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+
+namespace median_double_suite
+{
+
+void test_ctor()
+{
+    window::median<double, 4> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST(!filter.full());
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 0.0);
+}
+
+void test_odd()
+{
+    window::median<double, 3> filter;
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 3.0);
+    filter.push(1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 2.0);
+    filter.push(2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 2.0);
+    TRIAL_ONLINE_TEST(filter.full());
+    filter.push(5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 2.0);
+    filter.push(6.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.get<0>(), 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.get<2>(), 6.0);
+}
+
+void test_order()
+{
+    window::median<double, 5> filter;
+    filter.push(4.0);
+    filter.push(2.0);
+    filter.push(5.0);
+    filter.push(1.0);
+    filter.push(3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.order(0), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.order(1), 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.order(2), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.order(3), 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.order(4), 5.0);
+}
+
+void test_clear()
+{
+    window::median<double, 3> filter;
+    filter.push(1.0);
+    filter.push(2.0);
+    filter.push(3.0);
+    filter.push(4.0);
+    filter.clear();
+    TRIAL_ONLINE_TEST(filter.empty());
+    filter.push(10.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(), 10.0);
+}
+
+void run()
+{
+    test_ctor();
+    test_odd();
+    test_order();
+    test_clear();
+}
+
+} // namespace median_double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace quartile_double_suite
+{
+
+void test_fixed()
+{
+    {
+        window::quartile<double, 1> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 1, 100, 10));
+    }
+    {
+        window::quartile<double, 2> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 2, 100, 10));
+    }
+    {
+        window::quartile<double, 7> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 7, 1000, 10));
+    }
+    {
+        window::quartile<double, 16> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 16, 1000, 1000));
+    }
+    {
+        window::quartile<double, 100> filter;
+        TRIAL_ONLINE_TEST(compare(filter, 100, 2000, 5));
+    }
+}
+
+void test_dynamic()
+{
+    {
+        window::quartile<double, dynamic_extent> filter(1);
+        TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 1);
+        TRIAL_ONLINE_TEST(compare(filter, 1, 100, 10));
+    }
+    {
+        window::quartile<double, dynamic_extent> filter(37);
+        TRIAL_ONLINE_TEST_EQUAL(filter.capacity(), 37);
+        TRIAL_ONLINE_TEST(compare(filter, 37, 2000, 1000));
+    }
+    {
+        window::quartile<double, dynamic_extent> filter(256);
+        TRIAL_ONLINE_TEST(compare(filter, 256, 2000, 3));
+    }
+}
+
+void test_copy()
+{
+    window::quartile<double, 8> filter;
+    for (int k = 0; k < 20; ++k)
+        filter.push(double(k % 5));
+    auto copy = filter;
+    TRIAL_ONLINE_TEST_EQUAL(copy.get<1>(), filter.get<1>());
+    TRIAL_ONLINE_TEST_EQUAL(copy.get<2>(), filter.get<2>());
+    TRIAL_ONLINE_TEST_EQUAL(copy.get<3>(), filter.get<3>());
+    copy.push(100.0);
+    TRIAL_ONLINE_TEST_EQUAL(copy.get<4>(), 100.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.get<4>(), 4.0);
+}
+
+void test_footprint()
+{
+    // Window and blocks with about 3N values
+    TRIAL_ONLINE_TEST(sizeof(window::quartile<double, 1024>) < 4 * 1024 * sizeof(double));
+}
+
+void run()
+{
+    test_fixed();
+    test_dynamic();
+    test_copy();
+    test_footprint();
+}
+
+} // namespace quartile_double_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    median_double_suite::run();
+    quartile_double_suite::run();
+
+    return boost::report_errors();
+}
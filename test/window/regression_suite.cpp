@@ -153,9 +153,60 @@ void test_scatter()
     TRIAL_ONLINE_TEST_WITH(filter.at(0), 1.205, tolerance);
 }
 
+void test_dynamic()
+{
+    const double tolerance = 1e-6;
+    window::regression<double, 4> expect;
+    window::regression<double, dynamic_extent> filter(4);
+    for (int i = 0; i < 10; ++i)
+    {
+        const double x = double(i);
+        const double y = double(i * i);
+        expect.push(x, y);
+        filter.push(x, y);
+        TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+        TRIAL_ONLINE_TEST_CLOSE(filter.slope(), expect.slope(), tolerance);
+        TRIAL_ONLINE_TEST_CLOSE(filter.at(0), expect.at(0), tolerance);
+    }
+}
+
+void test_shared_window()
+{
+    // x inputs are only stored once
+    static_assert(sizeof(window::regression<double, 1024>) < sizeof(window::covariance<double, 1024>) + 64, "regression must share x window with covariance");
+
+    window::regression<double, 3> filter;
+    for (int i = 0; i < 999; ++i)
+    {
+        filter.push(1e6 + i, 1e6 - 2.0 * i);
+    }
+    filter.push(1.0, 3.0);
+    filter.push(2.0, 5.0);
+    filter.push(3.0, 7.0);
+    TRIAL_ONLINE_TEST_CLOSE(filter.slope(), 2.0, 1e-9);
+    TRIAL_ONLINE_TEST_CLOSE(filter.at(0), 1.0, 1e-9);
+}
+
+void test_offset()
+{
+    // Large offset in x must not cancel the x variance
+    window::regression<double, 64> filter;
+    for (int k = 0; k < 1000; ++k)
+    {
+        filter.push(1e8 + 0.5 * k, 2.0 * k + 1.0);
+        if (k > 0)
+        {
+            TRIAL_ONLINE_TEST_CLOSE(filter.slope(), 4.0, 1e-6);
+        }
+    }
+}
+
 void run()
 {
     test_ctor();
+    test_dynamic();
+    test_shared_window();
+    test_offset();
     test_same();
     test_linear_increase();
     test_exponential_increase();
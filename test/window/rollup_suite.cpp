@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/cumulative/moment.hpp>
+#include <trial/online/cumulative/comoment.hpp>
+#include <trial/online/window/rollup.hpp>
+
+using namespace trial::online;
+
+//-----------------------------------------------------------------------------
+
+namespace moment_suite
+{
+
+using moment_type = cumulative::moment_variance<double>;
+
+void test_ctor()
+{
+    window::rollup<moment_type, 4, 3, 2> filter;
+    TRIAL_ONLINE_TEST_EQUAL(filter.level_count, 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.slices(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.span(0), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.span(1), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.span(2), 6);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(0), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(10).size(), 0);
+}
+
+void test_promote()
+{
+    window::rollup<moment_type, 4, 3, 2> filter;
+    for (int slice = 0; slice < 20; ++slice)
+    {
+        filter.push(double(slice));
+        filter.push(double(slice));
+        filter.advance();
+    }
+    filter.push(100.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.slices(), 20);
+    TRIAL_ONLINE_TEST_EQUAL(filter.current().size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(0), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(1), 4);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(2), 3);
+    // Slices 16 to 19
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(0, 0).mean(), 16.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(0, 3).mean(), 19.0);
+    // Slices 6 to 17 in groups of three
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(1, 0).size(), 6);
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(1, 0).mean(), 7.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(1, 3).mean(), 16.0);
+    // Slices 0 to 17 in groups of six
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(2, 0).size(), 12);
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(2, 0).mean(), 2.5);
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(2, 2).mean(), 14.5);
+}
+
+void test_value()
+{
+    window::rollup<moment_type, 8, 3, 2> filter;
+    for (int slice = 0; slice < 20; ++slice)
+    {
+        filter.push(double(slice));
+        filter.advance();
+    }
+    // Slices 14 to 19
+    {
+        auto result = filter.value(6);
+        TRIAL_ONLINE_TEST_EQUAL(result.size(), 6);
+        TRIAL_ONLINE_TEST_EQUAL(result.mean(), 16.5);
+        TRIAL_ONLINE_TEST_CLOSE(result.variance(), (6.0 * 6.0 - 1.0) / 12.0, 1e-9);
+    }
+    // Slices 0 to 19
+    {
+        auto result = filter.value(20);
+        TRIAL_ONLINE_TEST_EQUAL(result.size(), 20);
+        TRIAL_ONLINE_TEST_EQUAL(result.mean(), 9.5);
+        TRIAL_ONLINE_TEST_CLOSE(result.variance(), (20.0 * 20.0 - 1.0) / 12.0, 1e-9);
+    }
+    // Truncated to retained slices
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(100).size(), 20);
+}
+
+void test_widen()
+{
+    window::rollup<moment_type, 4, 3, 2> filter;
+    for (int slice = 0; slice < 20; ++slice)
+    {
+        filter.push(double(slice));
+        filter.advance();
+    }
+    // Slices 8 to 19 requested, but slice 8 is only retained by the level
+    // one bucket with slices 6 to 8
+    auto result = filter.value(12);
+    TRIAL_ONLINE_TEST_EQUAL(result.size(), 14);
+    TRIAL_ONLINE_TEST_EQUAL(result.mean(), 12.5);
+    // All slices are retained by level two
+    TRIAL_ONLINE_TEST_EQUAL(filter.value(20).size(), 20);
+}
+
+void test_clear()
+{
+    window::rollup<moment_type, 4, 3, 2> filter;
+    for (int slice = 0; slice < 20; ++slice)
+    {
+        filter.push(double(slice));
+        filter.advance();
+    }
+    filter.clear();
+    TRIAL_ONLINE_TEST_EQUAL(filter.slices(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(2), 0);
+    filter.push(1.0);
+    filter.advance();
+    filter.push(2.0);
+    filter.advance();
+    filter.push(3.0);
+    filter.advance();
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(1), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.at(1, 0).mean(), 2.0);
+}
+
+void run()
+{
+    test_ctor();
+    test_promote();
+    test_value();
+    test_widen();
+    test_clear();
+}
+
+} // namespace moment_suite
+
+//-----------------------------------------------------------------------------
+
+namespace comoment_suite
+{
+
+using comoment_type = cumulative::covariance<double>;
+
+void test_value()
+{
+    window::rollup<comoment_type, 8, 4> filter;
+    comoment_type expect;
+    for (int slice = 0; slice < 8; ++slice)
+    {
+        filter.push(double(slice), 2.0 * slice);
+        expect.push(double(slice), 2.0 * slice);
+        filter.advance();
+    }
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(1), 2);
+    auto result = filter.value(8);
+    TRIAL_ONLINE_TEST_EQUAL(result.size(), 8);
+    TRIAL_ONLINE_TEST_CLOSE(result.variance(), expect.variance(), 1e-9);
+}
+
+void run()
+{
+    test_value();
+}
+
+} // namespace comoment_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    moment_suite::run();
+    comoment_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/window/comoment.hpp>
+#include <trial/online/window/timed_comoment.hpp>
+
+using namespace trial::online;
+using clock_type = std::chrono::steady_clock;
+using time_point = clock_type::time_point;
+using std::chrono::seconds;
+
+//-----------------------------------------------------------------------------
+
+namespace double_suite
+{
+
+void test_ctor()
+{
+    window::timed_covariance<double> filter(seconds(60));
+    TRIAL_ONLINE_TEST(filter.window() == seconds(60));
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+}
+
+void test_expire()
+{
+    window::timed_covariance<double> filter(seconds(2));
+    filter.push(time_point(seconds(0)), 1.0, 1.0);
+    filter.push(time_point(seconds(1)), 2.0, 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.25);
+    filter.push(time_point(seconds(2)), 4.0, 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 2);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), 2.0);
+    filter.expire(time_point(seconds(10)));
+    TRIAL_ONLINE_TEST(filter.empty());
+    filter.push(time_point(seconds(10)), 4.0, 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+}
+
+void test_same_as_count()
+{
+    // Regular timestamps correspond to a fixed window length
+    const double tolerance = 1e-6;
+    window::covariance<double, 4> expect;
+    window::timed_covariance<double> filter(seconds(4));
+    for (int i = 0; i < 100; ++i)
+    {
+        const double x = double(i % 13);
+        const double y = double(i * i % 7);
+        expect.push(x, y);
+        filter.push(time_point(seconds(i)), x, y);
+        TRIAL_ONLINE_TEST_EQUAL(filter.size(), expect.size());
+        TRIAL_ONLINE_TEST_CLOSE(filter.variance(), expect.variance(), tolerance);
+    }
+}
+
+void run()
+{
+    test_ctor();
+    test_expire();
+    test_same_as_count();
+}
+
+} // namespace double_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    double_suite::run();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2019 Bjorn Reese <breese@users.sourceforge.net>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <chrono>
+#include <deque>
+#include <random>
+#include <utility>
+#include <trial/online/detail/lightweight_test.hpp>
+#include <trial/online/window/timed_moment.hpp>
+
+using namespace trial::online;
+using clock_type = std::chrono::steady_clock;
+using time_point = clock_type::time_point;
+using std::chrono::seconds;
+using std::chrono::milliseconds;
+
+//-----------------------------------------------------------------------------
+
+namespace mean_double_suite
+{
+
+void test_ctor()
+{
+    window::timed_moment<double> filter(seconds(60));
+    TRIAL_ONLINE_TEST(filter.window() == seconds(60));
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0.0);
+}
+
+void test_expire()
+{
+    window::timed_moment<double> filter(seconds(10));
+    filter.push(time_point(seconds(0)), 1.0);
+    filter.push(time_point(seconds(5)), 2.0);
+    filter.push(time_point(seconds(5)), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    // Input at zero is exactly the window duration old
+    filter.push(time_point(seconds(10)), 6.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 11.0 / 3.0);
+    filter.expire(time_point(seconds(14)));
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 3);
+    filter.expire(time_point(seconds(15)));
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 6.0);
+    filter.expire(time_point(seconds(100)));
+    TRIAL_ONLINE_TEST(filter.empty());
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 0.0);
+}
+
+void test_clear()
+{
+    window::timed_moment<double> filter(seconds(10));
+    filter.push(time_point(seconds(0)), 1.0);
+    filter.push(time_point(seconds(1)), 2.0);
+    filter.clear();
+    TRIAL_ONLINE_TEST(filter.empty());
+    filter.push(time_point(seconds(2)), 4.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 4.0);
+}
+
+void run()
+{
+    test_ctor();
+    test_expire();
+    test_clear();
+}
+
+} // namespace mean_double_suite
+
+//-----------------------------------------------------------------------------
+
+namespace variance_double_suite
+{
+
+void test_expire()
+{
+    window::timed_moment_variance<double> filter(seconds(2));
+    filter.push(time_point(seconds(0)), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+    filter.push(time_point(seconds(1)), 3.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 2.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 1.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.unbiased_variance(), 2.0);
+    filter.push(time_point(seconds(2)), 7.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.mean(), 5.0);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 4.0);
+    filter.expire(time_point(seconds(3)));
+    TRIAL_ONLINE_TEST_EQUAL(filter.size(), 1);
+    TRIAL_ONLINE_TEST_EQUAL(filter.variance(), 0.0);
+}
+
+void test_varying_rate()
+{
+    // Rate changes by a factor of 1000
+    window::timed_moment_variance<double> filter(seconds(1));
+    std::deque<std::pair<time_point, double>> expect;
+    std::default_random_engine generator(42);
+    std::normal_distribution<double> distribution(1e3, 10.0);
+    time_point now;
+    bool result = true;
+    for (int k = 0; k < 20000; ++k)
+    {
+        now += ((k / 5000) % 2 == 0) ? milliseconds(1) : milliseconds(333);
+        const auto input = distribution(generator);
+        filter.push(now, input);
+        expect.emplace_back(now, input);
+        while (now - expect.front().first >= seconds(1))
+            expect.pop_front();
+
+        double mean = 0.0;
+        for (const auto& element : expect)
+            mean += element.second;
+        mean /= expect.size();
+        double variance = 0.0;
+        for (const auto& element : expect)
+            variance += (element.second - mean) * (element.second - mean);
+        variance /= expect.size();
+
+        result = result && (filter.size() == expect.size());
+        result = result && (std::abs(filter.mean() - mean) < 1e-9);
+        result = result && (std::abs(filter.variance() - variance) < 1e-6);
+    }
+    TRIAL_ONLINE_TEST(result);
+}
+
+void run()
+{
+    test_expire();
+    test_varying_rate();
+}
+
+} // namespace variance_double_suite
+
+//-----------------------------------------------------------------------------
+// main
+//-----------------------------------------------------------------------------
+
+int main()
+{
+    mean_double_suite::run();
+    variance_double_suite::run();
+
+    return boost::report_errors();
+}